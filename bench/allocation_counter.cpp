@@ -0,0 +1,53 @@
+/**
+ * @file allocation_counter.cpp
+ * @brief Purpose: Replaces the global operator new to count allocations.
+ *
+ * GPL v3.0 Licence
+ * Copyright (c) 2017 Azo
+ *
+ * Notice: TheAzo, TheAzoTeam
+ * https://github.com/TecProg2018-2/Azo
+*/
+#include "allocation_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<unsigned long> allocationCount(0);
+
+unsigned long Azo::getAllocationCount() {
+	return allocationCount;
+}
+
+void *operator new(std::size_t size) {
+	allocationCount++;
+
+	void *memory = std::malloc(size == 0 ? 1 : size);
+
+	if (memory == NULL) {
+		throw std::bad_alloc();
+	} else {
+		return memory;
+	}
+}
+
+void *operator new[](std::size_t size) {
+	return operator new(size);
+}
+
+void operator delete(void *memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept {
+	std::free(memory);
+}
@@ -0,0 +1,25 @@
+/**
+ * @file allocation_counter.hpp
+ * @brief Purpose: Counts the C++ heap allocations of the benchmark.
+ *
+ * GPL v3.0 Licence
+ * Copyright (c) 2017 Azo
+ *
+ * Notice: TheAzo, TheAzoTeam
+ * https://github.com/TecProg2018-2/Azo
+*/
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+
+namespace Azo {
+	/**
+	 * @brief total of "operator new" calls since the program started.
+	 *
+	 * Allocations made by SDL (malloc) aren't counted.
+	 *
+	 * @return the number of allocations.
+	*/
+	unsigned long getAllocationCount();
+}
+
+#endif
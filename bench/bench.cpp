@@ -0,0 +1,397 @@
+/**
+ * @file bench.cpp
+ * @brief Purpose: Headless benchmark suite of the game.
+ *
+ * GPL v3.0 Licence
+ * Copyright (c) 2017 Azo
+ *
+ * Notice: TheAzo, TheAzoTeam
+ * https://github.com/TecProg2018-2/Azo
+ *
+ * Runs each scenario in a process of its own, so peak memory and the game
+ * singleton don't leak between them, and prints one JSON line per scenario:
+ *
+ *   azo_bench [--frames N] [--draw] [--verbose] [scenario...]
+*/
+#include "game.hpp"
+#include "game_globals.hpp"
+#include "level_one.hpp"
+#include "level_generator.hpp"
+#include "player.hpp"
+#include "menu.hpp"
+#include "bench_scenes.hpp"
+#include "allocation_counter.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace Azo;
+
+const unsigned int DEFAULT_FRAMES = 3000;
+const unsigned int STRESS_OBSTACLES = 3000;
+const unsigned int STRESS_BLOCKS = 40000;
+const unsigned int CHURN_OBJECTS = 1500;
+const unsigned int STORM_SWITCH_FRAMES = 15; // Frames between two scene changes.
+const unsigned int JUMP_PERIOD = 90; // Frames between two jumps of the scripted track.
+const unsigned int JUMP_LENGTH = 20; // Frames the jump key is held.
+const unsigned int RESTART_PERIOD = 600; // Frames between two ENTER presses, to leave game over screens.
+const uint32_t ENDLESS_SEED = 2018;
+const double BOT_JUMP_DISTANCE = 60.0; // The endless bot jumps this close to an obstacle (pixels).
+const double BOT_SLIDE_DISTANCE = 80.0; // And slides this close to one, until it passed it.
+
+/**
+ * @brief A Scenario struct.
+ *
+ * setUp adds and chooses the scenes, script feeds the input before each frame.
+*/
+struct Scenario {
+	const char *name;
+	void (*setUp)();
+	void (*script)(unsigned int frame);
+};
+
+// Scenes live for the whole process, like the ones in main.
+static std::vector<engine::Scene *> sceneList;
+
+static void addScene(engine::Scene *scene) {
+	sceneList.push_back(scene);
+	engine::Game::instance.addScene(*scene);
+}
+
+static void noScript(unsigned int) {}
+
+static void setUpLevelOne() {
+	addScene(new LevelOne("level_one"));
+	addScene(new Menu("menu"));
+	engine::Game::instance.changeScene("menu");
+}
+
+// Starts the level from the menu, jumps at a steady rhythm and confirms the
+// game over screens, so the player dies, collects parts and restarts.
+static void scriptLevelOne(unsigned int frame) {
+	engine::InputManager &input = engine::Game::instance.inputManager;
+	const unsigned int START_FRAME = 5;
+
+	if (frame == START_FRAME || (frame > START_FRAME && frame % RESTART_PERIOD == 0)) {
+		input.releaseKey(engine::Button::ENTER);
+	} else {
+		//Nothing to do. ENTER isn't scripted on this frame.
+	}
+
+	if (frame % JUMP_PERIOD == 0) {
+		input.pressKey(engine::Button::W);
+	} else if (frame % JUMP_PERIOD == JUMP_LENGTH) {
+		input.releaseKey(engine::Button::W);
+	} else {
+		//Nothing to do. Keep the jump key as it is.
+	}
+}
+
+static LevelOne *endlessLevel = NULL;
+static unsigned int botChunk = 0; // First chunk on botObstacleList.
+static std::vector<LevelObstacle> botObstacleList; // Obstacles of botChunk and the one after it.
+static std::vector<LevelObstacle> botChunkObstacleList;
+static std::vector<LevelBlock> botBlockList; // Blocks of botObstacleList.
+static std::vector<LevelBlock> botChunkBlockList;
+
+static void setUpEndless() {
+	endlessLevel = new LevelOne("endless", ENDLESS_SEED);
+	addScene(endlessLevel);
+	engine::Game::instance.changeScene("endless");
+}
+
+// Asks the generator for the obstacles of the chunk the player is on and the next one.
+static void findBotObstacles(LevelGenerator &generator, unsigned int chunk) {
+	botChunk = chunk;
+	botObstacleList.clear();
+	botBlockList.clear();
+
+	for (unsigned int eachChunk = chunk; eachChunk <= chunk + 1; eachChunk++) {
+		generator.generateChunk(eachChunk, botChunkObstacleList, botChunkBlockList);
+
+		for (auto eachObstacle : botChunkObstacleList) {
+			if (eachObstacle.blockCount > 0 && eachObstacle.type != static_cast<uint32_t>(ObstacleType::GROUND)) {
+				botBlockList.push_back(botChunkBlockList[eachObstacle.firstBlock]);
+				eachObstacle.firstBlock = botBlockList.size() - 1;
+				botObstacleList.push_back(eachObstacle);
+			} else {
+				//Nothing to do. The bot walks on the ground and through machine parts.
+			}
+		}
+	}
+}
+
+// Plays the endless level the way the generator meant it: jumps over the
+// obstacles ahead of the player and slides under the others, and retries
+// when it dies anyway. The level goes on for as long as the frames do.
+static void scriptEndless(unsigned int frame) {
+	engine::InputManager &input = engine::Game::instance.inputManager;
+	LevelGenerator &generator = *endlessLevel->getGenerator();
+	std::string levelName = "level_one";
+	std::string playerName = "player";
+	engine::GameObject &level = endlessLevel->getGameObject(levelName);
+	Player &player = static_cast<Player &>(endlessLevel->getGameObject(playerName));
+
+	double playerLeft = player.mCurrentPosition.first - level.mCurrentPosition.first;
+	double playerRight = playerLeft + 2.0 * player.mHalfSize.first;
+	unsigned int chunk = static_cast<unsigned int>(playerLeft / generator.getChunkWidth());
+
+	if (frame == 0 || chunk != botChunk) {
+		findBotObstacles(generator, chunk);
+	} else {
+		//Nothing to do. The player is on the same chunk.
+	}
+
+	const LevelObstacle *nextObstacle = NULL;
+	double nextLeft = 0.0;
+
+	for (auto &eachObstacle : botObstacleList) {
+		const LevelBlock &block = botBlockList[eachObstacle.firstBlock];
+		double blockLeft = eachObstacle.x + block.x;
+
+		if (blockLeft + block.width > playerLeft && (nextObstacle == NULL || blockLeft < nextLeft)) {
+			nextObstacle = &eachObstacle;
+			nextLeft = blockLeft;
+		} else {
+			//Nothing to do. It was passed, or it's further.
+		}
+	}
+
+	bool jump = false;
+	bool slide = false;
+
+	if (nextObstacle != NULL) {
+		double distance = nextLeft - playerRight;
+
+		if (generator.mustSlide(static_cast<ObstacleType>(nextObstacle->type))) {
+			slide = distance < BOT_SLIDE_DISTANCE;
+		} else {
+			jump = distance >= 0.0 && distance < BOT_JUMP_DISTANCE;
+		}
+	} else {
+		//Nothing to do. There's nothing ahead.
+	}
+
+	if (jump) {
+		input.pressKey(engine::Button::W);
+	} else {
+		input.releaseKey(engine::Button::W);
+	}
+
+	if (slide) {
+		input.pressKey(engine::Button::S);
+	} else {
+		input.releaseKey(engine::Button::S);
+	}
+
+	if (player.mState == PlayerState::DIE && frame % RESTART_PERIOD == 0) {
+		input.releaseKey(engine::Button::ENTER);
+	} else {
+		//Nothing to do. The player is alive, or waits for the game over screen.
+	}
+}
+
+static void setUpObstacleStress() {
+	addScene(new ObstacleStressScene("obstacle_stress", STRESS_OBSTACLES));
+	engine::Game::instance.changeScene("obstacle_stress");
+}
+
+static void setUpCollisionStress() {
+	addScene(new CollisionStressScene("collision_stress", STRESS_BLOCKS));
+	engine::Game::instance.changeScene("collision_stress");
+}
+
+static void setUpAnimationChurn() {
+	addScene(new AnimationChurnScene("animation_churn", CHURN_OBJECTS));
+	engine::Game::instance.changeScene("animation_churn");
+}
+
+static void setUpSceneSwitchStorm() {
+	addScene(new LevelOne("level_one"));
+	addScene(new AnimationChurnScene("animation_churn", CHURN_OBJECTS / 10));
+	engine::Game::instance.changeScene("level_one");
+}
+
+// Alternates between the level and a small animated scene, so every
+// switch shuts one down and restarts the other.
+static void scriptSceneSwitchStorm(unsigned int frame) {
+	if (frame > 0 && frame % STORM_SWITCH_FRAMES == 0) {
+		bool toLevel = (frame / STORM_SWITCH_FRAMES) % 2 == 0;
+		engine::Game::instance.changeScene(toLevel ? "level_one" : "animation_churn");
+	} else {
+		//Nothing to do. Stay on the scene.
+	}
+}
+
+const Scenario SCENARIOS[] = {
+	{"level_one_scripted", setUpLevelOne, scriptLevelOne},
+	{"obstacle_stress", setUpObstacleStress, noScript},
+	{"collision_stress", setUpCollisionStress, noScript},
+	{"animation_churn", setUpAnimationChurn, noScript},
+	{"scene_switch_storm", setUpSceneSwitchStorm, scriptSceneSwitchStorm},
+	{"endless_scripted", setUpEndless, scriptEndless},
+};
+const unsigned int SCENARIO_COUNT = sizeof(SCENARIOS) / sizeof(SCENARIOS[0]);
+
+/**
+ * @brief peak resident memory of this process.
+ *
+ * @return the peak RSS (kilobytes).
+*/
+static long getPeakRss() {
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+
+	return usage.ru_maxrss;
+}
+
+/**
+ * @brief run a scenario in this process and print its result.
+ *
+ * Every frame is one fixed simulation step, so the same build always
+ * simulates the same thing.
+ *
+ * @param resultFile where the JSON line goes, the game logs are elsewhere.
+*/
+static void runScenario(const Scenario &scenario, unsigned int frames, bool draw, FILE *resultFile) {
+	engine::Game &game = engine::Game::instance;
+
+	game.setAttributes(global::GAME_NAME, global::WINDOWN_WIDTH, global::WINDOWN_HEIGHT, global::FRAME_RATE);
+	game.setSimulationRate(global::SIMULATION_RATE);
+	game.setHeadless(true, draw);
+	game.inputManager.setScripted(true);
+
+	scenario.setUp();
+	game.start();
+
+	unsigned long allocationsBefore = getAllocationCount();
+	Uint64 startTime = engine::Timer::getNanoseconds();
+	unsigned int frame = 0;
+	unsigned long culledDraws = 0;
+
+	for (frame = 0; frame < frames; frame++) {
+		scenario.script(frame);
+
+		if (game.runFrame() == false) {
+			break;
+		} else {
+			culledDraws += game.getRenderQueue().getCulledCount();
+		}
+	}
+
+	Uint64 elapsedTime = engine::Timer::getNanoseconds() - startTime;
+	unsigned long allocations = getAllocationCount() - allocationsBefore;
+
+	game.stop();
+
+	double framesRun = frame > 0 ? frame : 1;
+
+	fprintf(resultFile,
+	        "{\"scenario\":\"%s\",\"frames\":%u,\"ns_per_frame\":%.0f,"
+	        "\"allocations_per_frame\":%.2f,\"culled_draws_per_frame\":%.2f,\"peak_rss_kb\":%ld}\n",
+	        scenario.name, frame, elapsedTime / framesRun,
+	        allocations / framesRun, culledDraws / framesRun, getPeakRss());
+	fflush(resultFile);
+}
+
+/**
+ * @brief run a scenario on a child process.
+ *
+ * The child keeps the real standard output for its result and sends the
+ * game logs to /dev/null, unless verbose.
+ *
+ * @return true when the scenario finished.
+*/
+static bool forkScenario(const Scenario &scenario, unsigned int frames, bool draw, bool verbose) {
+	fflush(stdout);
+	pid_t child = fork();
+
+	if (child < 0) {
+		perror("fork");
+		return false;
+	} else if (child == 0) {
+		FILE *resultFile = fdopen(dup(STDOUT_FILENO), "w");
+
+		if (verbose == false) {
+			int nullFile = open("/dev/null", O_WRONLY);
+			dup2(nullFile, STDOUT_FILENO);
+			dup2(nullFile, STDERR_FILENO);
+		} else {
+			//Nothing to do. The logs stay on the terminal.
+		}
+
+		runScenario(scenario, frames, draw, resultFile);
+		_exit(EXIT_SUCCESS);
+	} else {
+		//Nothing to do. The parent waits below.
+	}
+
+	int status = 0;
+	waitpid(child, &status, 0);
+
+	if (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS) {
+		return true;
+	} else {
+		printf("{\"scenario\":\"%s\",\"error\":\"exited with status %d\"}\n", scenario.name, status);
+		return false;
+	}
+}
+
+int main(int argc, char **argv) {
+	unsigned int frames = DEFAULT_FRAMES;
+	bool draw = false;
+	bool verbose = false;
+	std::vector<const Scenario *> chosenScenarios;
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+			i++;
+			frames = strtoul(argv[i], NULL, 10);
+		} else if (strcmp(argv[i], "--draw") == 0) {
+			draw = true;
+		} else if (strcmp(argv[i], "--verbose") == 0) {
+			verbose = true;
+		} else {
+			bool found = false;
+
+			for (unsigned int j = 0; j < SCENARIO_COUNT; j++) {
+				if (strcmp(argv[i], SCENARIOS[j].name) == 0) {
+					chosenScenarios.push_back(&SCENARIOS[j]);
+					found = true;
+				} else {
+					//Nothing to do. Try the next scenario.
+				}
+			}
+
+			if (found == false) {
+				fprintf(stderr, "Unknown scenario or option: %s\n", argv[i]);
+				return EXIT_FAILURE;
+			} else {
+				//Nothing to do. The scenario was chosen.
+			}
+		}
+	}
+
+	if (chosenScenarios.empty()) {
+		for (unsigned int j = 0; j < SCENARIO_COUNT; j++) {
+			chosenScenarios.push_back(&SCENARIOS[j]);
+		}
+	} else {
+		//Nothing to do. Run only the chosen ones.
+	}
+
+	bool allFinished = true;
+
+	for (auto eachScenario : chosenScenarios) {
+		allFinished = forkScenario(*eachScenario, frames, draw, verbose) && allFinished;
+	}
+
+	return allFinished ? EXIT_SUCCESS : EXIT_FAILURE;
+}
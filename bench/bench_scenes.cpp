@@ -0,0 +1,264 @@
+/**
+ * @file bench_scenes.cpp
+ * @brief Purpose: Implementation of the scenes used only by the benchmark.
+ *
+ * GPL v3.0 Licence
+ * Copyright (c) 2017 Azo
+ *
+ * Notice: TheAzo, TheAzoTeam
+ * https://github.com/TecProg2018-2/Azo
+*/
+#include "bench_scenes.hpp"
+#include "animation_controller.hpp"
+
+using namespace Azo;
+
+const double STRESS_SPACING = 60.0; // Distance between two obstacles (pixels).
+const double STRESS_SCROLL_SPEED = 0.24; // Same as LevelOne (pixels per milisecond).
+const double BLOCK_SPACING = 12.0; // Distance between two blocks of the collision stress level (pixels).
+const unsigned int PROBE_COUNT = 8; // Boxes moved over the collision stress level.
+const double PROBE_SPACING = 400.0; // Distance between two probes (pixels).
+const double PROBE_WIDTH = 73.0; // Same as the player (pixels).
+const double PROBE_HEIGHT = 105.0;
+const double CHURN_COLUMNS = 30; // Animated objects per row.
+const double CHURN_SPACING = 40.0; // Distance between two animated objects (pixels).
+const unsigned int SPIN_SPRITES = 12;
+const unsigned int SPIN_SPRITE_Y = 11;
+const unsigned int SPIN_SPRITE_SIZE = 36;
+const unsigned int SPIN_SPRITE_STEP = 37; // Distance between two sprites on the sheet (pixels).
+
+// Obstacles used by the stress scene, in turn, with their height on the level.
+const ObstacleType STRESS_TYPES[] = {
+	ObstacleType::WESTERN_BOX,
+	ObstacleType::WESTERN_RAISED_BOX,
+	ObstacleType::WESTERN_CAR,
+	ObstacleType::WESTERN_ROCK,
+	ObstacleType::WESTERN_SPIKE,
+	ObstacleType::WESTERN_POST,
+	ObstacleType::MACHINE_PART
+};
+const double STRESS_HEIGHTS[] = {300, 200, 300, 340, 340, 0, 80};
+const unsigned int STRESS_TYPE_COUNT = 7;
+
+StressCode::StressCode(engine::GameObject &gameObject, double levelWidth) :
+	engine::CodeComponent(gameObject) {
+	mLevelWidth = levelWidth;
+}
+
+void StressCode::init() {
+	// The obstacle colliders scroll with the level.
+	engine::Game::instance.getPhysicsWorld().setOrigin(gameObject);
+}
+
+void StressCode::updateCode() {
+	gameObject->mCurrentPosition.first -= STRESS_SCROLL_SPEED * engine::Game::instance.getTimer().getDeltaTime();
+
+	if (gameObject->mCurrentPosition.first < -mLevelWidth) {
+		gameObject->mCurrentPosition.first = 0;
+	} else {
+		//Nothing to do. The level hasn't reached its end.
+	}
+}
+
+ObstacleStressScene::ObstacleStressScene(std::string name, unsigned int obstacleCount) {
+	ASSERT(name != "", "Name can`t be blank.");
+	this->sceneName = name;
+	mObstacleCount = obstacleCount;
+	createGameObjects();
+}
+
+ObstacleStressScene::~ObstacleStressScene() {
+	deleteGameObjects();
+}
+
+void ObstacleStressScene::restart() {
+	deleteGameObjects();
+	createGameObjects();
+}
+
+void ObstacleStressScene::createGameObjects() {
+	mLevel = mArena.create<engine::GameObject>("stress_level", std::make_pair(0, 0));
+
+	for (unsigned int i = 0; i < mObstacleCount; i++) {
+		unsigned int type = i % STRESS_TYPE_COUNT;
+		Obstacle *obstacle = mArena.create<Obstacle>(
+			"stress_obstacle_" + std::to_string(i),
+			std::make_pair(i * STRESS_SPACING, STRESS_HEIGHTS[type]),
+			STRESS_TYPES[type],
+			mArena
+		);
+
+		obstacle->setParent(mLevel);
+		mObstacleList.push_back(obstacle);
+		mLevel->mParentList.push_back(obstacle);
+	}
+
+	mCode = mArena.create<StressCode>(*mLevel, mObstacleCount * STRESS_SPACING);
+	mLevel->addComponent(*mCode);
+	addGameObject(*mLevel);
+
+	for (auto eachObstacle : mObstacleList) {
+		addGameObject(*eachObstacle);
+	}
+}
+
+void ObstacleStressScene::deleteGameObjects() {
+	gameObjectMap.clear();
+	deleteKeyList();
+	mObstacleList.clear();
+	mArena.reset();
+}
+
+ProbeCode::ProbeCode(engine::GameObject &gameObject, engine::CollisionWorld &collisionWorld, double levelWidth) :
+	engine::CodeComponent(gameObject), mContactManifold(5.0, 16.0) {
+	mCollisionWorld = &collisionWorld;
+	mLevelWidth = levelWidth;
+	mPosition = 0.0;
+}
+
+void ProbeCode::updateCode() {
+	double moveX = STRESS_SCROLL_SPEED * engine::Game::instance.getTimer().getDeltaTime();
+	mPosition += moveX;
+
+	if (mPosition > mLevelWidth) {
+		mPosition = 0.0;
+	} else {
+		//Nothing to do. The probes haven't reached the end.
+	}
+
+	for (unsigned int i = 0; i < PROBE_COUNT; i++) {
+		double left = mPosition + i * PROBE_SPACING;
+		double top = 240.0 + (i % 3) * 40.0; // Some probes stand on the blocks, some cross them.
+		engine::CollisionBox probeBox = {left, top, left + PROBE_WIDTH, top + PROBE_HEIGHT};
+		engine::CollisionBox sweptBox = {left - moveX, top, left + PROBE_WIDTH, top + PROBE_HEIGHT};
+
+		mContactManifold.clear();
+		mCollisionWorld->findOverlaps(sweptBox, mOverlapList);
+
+		for (auto eachOverlap : mOverlapList) {
+			mContactManifold.addSweptSolid(probeBox, moveX, 0.0, mCollisionWorld->getBox(eachOverlap), gameObject);
+		}
+	}
+}
+
+CollisionStressScene::CollisionStressScene(std::string name, unsigned int blockCount) {
+	ASSERT(name != "", "Name can`t be blank.");
+	this->sceneName = name;
+	mBlockCount = blockCount;
+	createGameObjects();
+}
+
+CollisionStressScene::~CollisionStressScene() {
+	deleteGameObjects();
+}
+
+void CollisionStressScene::restart() {
+	deleteGameObjects();
+	createGameObjects();
+}
+
+void CollisionStressScene::createGameObjects() {
+	mCollisionWorld.clear();
+
+	// Blocks of the level one sizes, overlapping each other a little.
+	for (unsigned int i = 0; i < mBlockCount; i++) {
+		double left = i * BLOCK_SPACING;
+		double top = 300.0 + (i * 37 % 11) * 10.0;
+		double width = 4.0 + (i * 53 % 7) * 30.0;
+		engine::CollisionBox blockBox = {left, top, left + width, top + 100.0};
+
+		mCollisionWorld.addBox(blockBox);
+	}
+
+	mProbe = mArena.create<engine::GameObject>("probe", std::make_pair(0, 0));
+	mCode = mArena.create<ProbeCode>(*mProbe, mCollisionWorld, mBlockCount * BLOCK_SPACING);
+	mProbe->addComponent(*mCode);
+	addGameObject(*mProbe);
+}
+
+void CollisionStressScene::deleteGameObjects() {
+	gameObjectMap.clear();
+	deleteKeyList();
+	mCollisionWorld.clear();
+	mArena.reset();
+}
+
+ChurnCode::ChurnCode(engine::GameObject &gameObject, engine::AnimationController &animationController,
+                     unsigned int switchSteps) : engine::CodeComponent(gameObject) {
+	ASSERT(switchSteps > 0, "The steps between switches must be bigger than zero.");
+	mAnimationController = &animationController;
+	mSwitchSteps = switchSteps;
+	mStep = 0;
+	mFast = false;
+}
+
+void ChurnCode::updateCode() {
+	mStep++;
+
+	if (mStep % mSwitchSteps == 0) {
+		mFast = !mFast;
+		mAnimationController->startUniqueAnimation(mFast ? "spin_fast" : "spin_slow");
+	} else {
+		//Nothing to do. Keep the animation.
+	}
+}
+
+AnimationChurnScene::AnimationChurnScene(std::string name, unsigned int objectCount) {
+	ASSERT(name != "", "Name can`t be blank.");
+	this->sceneName = name;
+	mObjectCount = objectCount;
+	createGameObjects();
+}
+
+AnimationChurnScene::~AnimationChurnScene() {
+	deleteGameObjects();
+}
+
+void AnimationChurnScene::restart() {
+	deleteGameObjects();
+	createGameObjects();
+}
+
+engine::Animation *AnimationChurnScene::createSpinAnimation(engine::GameObject &gameObject, float animationTime) {
+	std::vector<engine::Sprite *> spriteList;
+
+	for (unsigned int i = 0; i < SPIN_SPRITES; i++) {
+		spriteList.push_back(mArena.create<engine::Sprite>(SPIN_SPRITE_SIZE, SPIN_SPRITE_SIZE,
+		                                                   i * SPIN_SPRITE_STEP, SPIN_SPRITE_Y));
+	}
+
+	return mArena.create<engine::Animation>(gameObject, "sprites/machine_part.png", animationTime,
+	                                        spriteList, 0, SPIN_SPRITES - 1, true, 1.0);
+}
+
+void AnimationChurnScene::createGameObjects() {
+	const float FAST_SPIN_TIME = 300.0f;
+	const float SLOW_SPIN_TIME = 1200.0f;
+	const unsigned int MIN_SWITCH_STEPS = 3;
+	const unsigned int SWITCH_STEPS_VARIATION = 7;
+
+	for (unsigned int i = 0; i < mObjectCount; i++) {
+		unsigned int column = i % (unsigned int) CHURN_COLUMNS;
+		unsigned int row = i / (unsigned int) CHURN_COLUMNS;
+		engine::GameObject *object = mArena.create<engine::GameObject>("churn_object_" + std::to_string(i), std::make_pair(0, 0));
+		object->mCurrentPosition = std::make_pair(column * CHURN_SPACING, row * CHURN_SPACING);
+
+		engine::AnimationController *animationController = mArena.create<engine::AnimationController>(*object);
+		animationController->addAnimation("spin_fast", *createSpinAnimation(*object, FAST_SPIN_TIME));
+		animationController->addAnimation("spin_slow", *createSpinAnimation(*object, SLOW_SPIN_TIME));
+		object->addComponent(*animationController);
+
+		// Objects switch at different rates, so some switch on every step.
+		ChurnCode *code = mArena.create<ChurnCode>(*object, *animationController,
+		                                           MIN_SWITCH_STEPS + i % SWITCH_STEPS_VARIATION);
+		object->addComponent(*code);
+
+		addGameObject(*object);
+	}
+}
+
+void AnimationChurnScene::deleteGameObjects() {
+	gameObjectMap.clear();
+	deleteKeyList();
+	mArena.reset();
+}
@@ -0,0 +1,133 @@
+/**
+ * @file bench_scenes.hpp
+ * @brief Purpose: Contains the scenes used only by the benchmark.
+ *
+ * GPL v3.0 Licence
+ * Copyright (c) 2017 Azo
+ *
+ * Notice: TheAzo, TheAzoTeam
+ * https://github.com/TecProg2018-2/Azo
+*/
+#ifndef BENCH_SCENES_HPP
+#define BENCH_SCENES_HPP
+
+#include "scene.hpp"
+#include "code_component.hpp"
+#include "obstacle.hpp"
+#include "collision_world.hpp"
+#include "contact_manifold.hpp"
+
+#include <string>
+#include <vector>
+
+namespace Azo {
+	/**
+	 * @brief StressCode class
+	 * Scrolls the stress level, which the obstacles are placed on, like
+	 * LevelOneCode does, wrapping around at the end.
+	 */
+	class StressCode : public engine::CodeComponent {
+		public:
+			StressCode(engine::GameObject &gameObject, double levelWidth);
+			void init();
+			void updateCode();
+
+		private:
+			double mLevelWidth; // Scrolled distance before wrapping around (pixels).
+	};
+
+	/**
+	 * @brief ObstacleStressScene class
+	 * A level made only of thousands of obstacles.
+	 */
+	class ObstacleStressScene : public engine::Scene {
+		public:
+			ObstacleStressScene(std::string name, unsigned int obstacleCount);
+			~ObstacleStressScene();
+			void restart();
+
+		private:
+			unsigned int mObstacleCount;
+			engine::GameObject *mLevel; // Parent of every obstacle, scrolled by mCode.
+			StressCode *mCode;
+			std::vector<Obstacle *> mObstacleList;
+
+			void createGameObjects();
+			void deleteGameObjects();
+	};
+
+	/**
+	 * @brief ProbeCode class
+	 * Moves a row of player sized boxes over a collision world and gathers
+	 * their contacts on every step, like LevelOneCode does for the player.
+	 */
+	class ProbeCode : public engine::CodeComponent {
+		public:
+			ProbeCode(engine::GameObject &gameObject, engine::CollisionWorld &collisionWorld, double levelWidth);
+			void updateCode();
+
+		private:
+			engine::CollisionWorld *mCollisionWorld;
+			engine::ContactManifold mContactManifold;
+			std::vector<unsigned int> mOverlapList;
+			double mLevelWidth; // Distance moved before wrapping around (pixels).
+			double mPosition; // Left of the first probe (pixels).
+	};
+
+	/**
+	 * @brief CollisionStressScene class
+	 * A level made only of tens of thousands of static blocks.
+	 */
+	class CollisionStressScene : public engine::Scene {
+		public:
+			CollisionStressScene(std::string name, unsigned int blockCount);
+			~CollisionStressScene();
+			void restart();
+
+		private:
+			unsigned int mBlockCount;
+			engine::CollisionWorld mCollisionWorld;
+			engine::GameObject *mProbe; // Holds mCode, isn't drawn.
+			ProbeCode *mCode;
+
+			void createGameObjects();
+			void deleteGameObjects();
+	};
+
+	/**
+	 * @brief ChurnCode class
+	 * Switches its game object between two animations every few steps.
+	 */
+	class ChurnCode : public engine::CodeComponent {
+		public:
+			ChurnCode(engine::GameObject &gameObject, engine::AnimationController &animationController,
+			          unsigned int switchSteps);
+			void updateCode();
+
+		private:
+			engine::AnimationController *mAnimationController;
+			unsigned int mSwitchSteps; // Steps between two switches.
+			unsigned int mStep;
+			bool mFast; // Playing the fast animation.
+	};
+
+	/**
+	 * @brief AnimationChurnScene class
+	 * Many animated objects switching animations all the time.
+	 */
+	class AnimationChurnScene : public engine::Scene {
+		public:
+			AnimationChurnScene(std::string name, unsigned int objectCount);
+			~AnimationChurnScene();
+			void restart();
+
+		private:
+			unsigned int mObjectCount;
+
+			void createGameObjects();
+			void deleteGameObjects();
+			engine::Animation *createSpinAnimation(engine::GameObject &gameObject, float animationTime);
+	};
+}
+
+#endif
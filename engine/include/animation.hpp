@@ -72,9 +72,13 @@ namespace engine {
 		);
 		virtual ~Animation();
 
+		void init();
 		void shutdown();
 		void draw();
+		void updateAnimation();
 		void disableComponent();
+		void saveState(StateBuffer &stateBuffer);
+		void loadState(StateBuffer &stateBuffer);
 		inline std::string getClassName(){
 			return "Animation";
 		}
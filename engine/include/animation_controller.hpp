@@ -43,7 +43,9 @@ namespace engine {
 		
 		void init();
 		void shutdown();
-		void draw();
+		void collectAssets(AssetList &assetList);
+		void saveState(StateBuffer &stateBuffer);
+		void loadState(StateBuffer &stateBuffer);
 		void nextSprite(std::string name);
 		inline std::string getClassName(){
 			return "AnimationController";
@@ -0,0 +1,100 @@
+/**
+ * @file arena.hpp
+ * @brief Purpose: Contains the Arena class declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include "log.h"
+#include <vector>
+#include <new>
+#include <cstddef>
+
+namespace engine {
+
+	/**
+	 * @brief An Arena class.
+	 *
+	 * Objects that live and die together, such as the game objects of a
+	 * scene. They're placed one after the other on big chunks of memory
+	 * instead of being allocated one by one, and "reset" destroys all of
+	 * them at once, newest first. The chunks are kept, so building the same
+	 * objects again doesn't allocate.
+	*/
+	class Arena {
+		public:
+			Arena(std::size_t chunkSize);
+			~Arena();
+
+			void *allocate(std::size_t size, std::size_t alignment);
+			void reset();
+
+			/**
+			 * @brief build an object on the arena.
+			 *
+			 * The object is destroyed by "reset", it mustn't be deleted.
+			 *
+			 * @param arguments passed to the constructor of the object.
+			 *
+			 * @return the new object.
+			*/
+			template <typename T, typename... Arguments>
+			T *create(Arguments&&... arguments) {
+				Destructor *destructor = static_cast<Destructor *>(allocate(sizeof(Destructor), alignof(Destructor)));
+				void *memory = allocate(sizeof(T), alignof(T));
+				T *object = new (memory) T(static_cast<Arguments&&>(arguments)...);
+
+				destructor->object = object;
+				destructor->destroy = &destroyObject<T>;
+				destructor->next = mDestructorList;
+				mDestructorList = destructor;
+				mObjectCount++;
+				return object;
+			}
+
+			unsigned int getObjectCount();
+			std::size_t getUsedSize();
+
+		private:
+			/**
+			 * @brief How to destroy one object of the arena.
+			 *
+			 * Kept on the arena itself, right before its object.
+			*/
+			struct Destructor {
+				void *object;
+				void (*destroy)(void *object);
+				Destructor *next; // Destructor of the object created before this one.
+			};
+
+			/**
+			 * @brief A chunk of memory of the arena.
+			*/
+			struct Chunk {
+				unsigned char *memory;
+				std::size_t size;
+			};
+
+			template <typename T>
+			static void destroyObject(void *object) {
+				static_cast<T *>(object)->~T();
+			}
+
+			std::size_t mChunkSize; // Size of a new chunk (bytes), unless an object needs more.
+			std::vector<Chunk> mChunkList;
+			unsigned int mCurrentChunk; // Chunk where objects are being placed.
+			std::size_t mChunkPosition; // First free byte of the current chunk.
+			Destructor *mDestructorList; // Newest object first, NULL when the arena is empty.
+			unsigned int mObjectCount;
+
+			Arena(const Arena &);
+			Arena &operator=(const Arena &);
+	};
+}
+
+#endif
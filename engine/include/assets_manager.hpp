@@ -12,6 +12,11 @@
 
 #include <iostream>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <list>
+#include <thread>
+#include <mutex>
 
 #include "sdl2include.h"
 #include "log.h"
@@ -25,6 +30,33 @@ namespace engine {
 		unsigned int height;
 	};
 
+	//struct used to list the assets a scene will load on its init.
+	struct AssetList {
+		std::vector<std::string> imagePaths;
+		std::vector<std::string> musicPaths;
+		std::vector<std::string> soundPaths;
+	};
+
+	/*
+	 * @brief Class for the kinds of asset.
+	 *
+	 * Enum class used to tell the preloaded assets apart.
+	 */
+	enum class AssetType {
+		IMAGE,
+		MUSIC,
+		SOUND
+	};
+
+	//struct used to hand an asset from the preload thread to the main thread.
+	struct PreloadedAsset {
+		AssetType type;
+		std::string path;
+		SDL_Surface *surface; // Decoded image, still without texture.
+		Mix_Music *music;
+		Mix_Chunk *sound;
+	};
+
 	/*
 	 * @brief Class for possible errors types.
 	 * 
@@ -49,9 +81,23 @@ namespace engine {
 			std::unordered_map<std::string, Image *> imageMap;     // Map of all images already loaded.
 			std::unordered_map<std::string, Mix_Music *> musicMap; // Map of all musics already loaded.
 			std::unordered_map<std::string, Mix_Chunk *> soundMap; // Map of all sounds already loaded.
+			std::unordered_set<std::string> pendingPaths; // Preloaded assets not yet in the maps (main thread only).
+			std::list<PreloadedAsset> preloadQueue; // Assets waiting to be decoded by the preload thread.
+			std::list<PreloadedAsset> decodedQueue; // Assets decoded, waiting to be uploaded by the main thread.
+			std::mutex preloadMutex; // Guards the queues above and preloadRunning.
+			std::thread preloadThread; // Decodes the queued assets.
+			bool preloadRunning; // The preload thread is still decoding.
 		public:
 			AssetsManager();
 
+			void preload(const AssetList &assetList);
+
+			bool uploadPreloaded(double timeBudget);
+
+			void finishPreloading();
+
+			void stopPreloading();
+
 			Image* LoadImage(std::string imagePath);
 
 			Mix_Music* LoadMusic(std::string audioPath);
@@ -64,6 +110,10 @@ namespace engine {
 			void InsertIntoImageMap(std::string imagePath, SDL_Surface* image, SDL_Texture *imageTexture);
 			void InsertIntoMusicMap(std::string audioPath, Mix_Music * music);
 			void InsertIntoSoundMap(std::string audioPath, Mix_Chunk * sound);
+			void queuePreload(AssetType type, const std::vector<std::string> &paths);
+			void preloadLoop();
+			void decodeAsset(PreloadedAsset &asset);
+			void uploadAsset(PreloadedAsset &asset);
 	};
 }
 
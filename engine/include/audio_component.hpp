@@ -66,7 +66,10 @@ ra	 *Enum Class used to differentiate Audio States
 					   bool isMusic, bool playOnStart);
 		void init();
 		void shutdown();
-		void updateCode();
+		void updateAudio();
+		void collectAssets(AssetList &assetList);
+		void saveState(StateBuffer &stateBuffer);
+		void loadState(StateBuffer &stateBuffer);
 		void play(int loops, int channel);
 		void stop(int channel);
 		void pause(int channel);
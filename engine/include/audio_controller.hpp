@@ -44,7 +44,9 @@ namespace engine {
 		virtual ~AudioController();
 		AudioController(GameObject &gameObject);
 		void init();
-		void updateCode();
+		void collectAssets(AssetList &assetList);
+		void saveState(StateBuffer &stateBuffer);
+		void loadState(StateBuffer &stateBuffer);
 		void addAudio(std::string audioName, AudioComponent &audio);
 		void playAudio(std::string audioName);
 		void stopAudio(std::string audioName);
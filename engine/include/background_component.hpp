@@ -39,6 +39,7 @@ namespace engine {
     void init();
     void shutdown();
     void draw();
+    void collectAssets(AssetList &assetList);
     inline std::string getClassName(){
       return "BackgroundComponent";
     }
@@ -0,0 +1,61 @@
+/**
+ * @file camera.hpp
+ * @brief Purpose: Contains the Camera class declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef CAMERA_HPP
+#define CAMERA_HPP
+
+#include <utility>
+
+namespace engine {
+
+	class StateBuffer;
+
+	/**
+	 * @brief A Camera class.
+	 *
+	 * Part of the world seen on the screen, from its left upper corner. The
+	 * game objects stay where they are on the world and the camera moves:
+	 * images and animations subtract its view position when they're drawn,
+	 * unless their game object is fixed on the screen. Like the game objects,
+	 * it keeps its position on the last simulation step, so it's drawn
+	 * between the two.
+	*/
+	class Camera {
+		public:
+			Camera();
+
+			void reset();
+			void setPosition(std::pair<double, double> position);
+			void move(double moveX, double moveY);
+			void storePreviousPosition();
+			void updateView(double interpolationFactor);
+			void saveState(StateBuffer &stateBuffer);
+			void loadState(StateBuffer &stateBuffer);
+
+			inline std::pair<double, double> getPosition() {
+				return mPosition;
+			}
+
+			/**
+			 * @brief access the position the frame is drawn from.
+			 *
+			 * @return the left upper corner of the view, set by "updateView".
+			*/
+			inline const std::pair<double, double> &getViewPosition() {
+				return mViewPosition;
+			}
+
+		private:
+			std::pair<double, double> mPosition; // Left upper corner on the world (pixels).
+			std::pair<double, double> mPreviousPosition; // Position on the last simulation step.
+			std::pair<double, double> mViewPosition; // Position the current frame is drawn from.
+	};
+}
+
+#endif
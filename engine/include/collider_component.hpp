@@ -0,0 +1,150 @@
+/**
+ * @file collider_component.hpp
+ * @brief Purpose: Contains the ColliderComponent class declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef COLLIDER_COMPONENT_HPP
+#define COLLIDER_COMPONENT_HPP
+
+#include "component.hpp"
+#include "game_object.hpp"
+#include "collision_box.hpp"
+#include "contact_manifold.hpp"
+#include <vector>
+
+namespace engine {
+
+	/**
+	 * @brief A collider type class.
+	 *
+	 * Static colliders never move on the world, or relative to the origin
+	 * of the physics world when one is set. Dynamic colliders move and get
+	 * contacts on every step.
+	*/
+	enum class ColliderType {
+		STATIC,
+		DYNAMIC
+	};
+
+	/**
+	 * @brief A ColliderComponent class.
+	 *
+	 * Box of a game object on the physics world. The box is either fixed,
+	 * relative to the game object position, or follows the measures the
+	 * game object already has (such as the ones set by its animation).
+	 * Triggers don't block anything, they're only reported. Two colliders
+	 * only see each other when the mask of one has the layer of the other.
+	*/
+	class ColliderComponent : public Component {
+		public:
+			static const unsigned int ALL_LAYERS = 0xFFFFFFFF;
+
+			ColliderComponent(GameObject &gameObject, ColliderType colliderType);
+			ColliderComponent(GameObject &gameObject, ColliderType colliderType,
+			                  std::pair<double, double> offset, std::pair<double, double> size);
+
+			void init();
+			void shutdown();
+			void loadState(StateBuffer &stateBuffer);
+			CollisionBox calcBox();
+			void setWallInset(double wallInsetX, double wallInsetY);
+
+			/**
+			 * @brief check if the collider has a box yet.
+			 *
+			 * Colliders following the game object measures have none until
+			 * something (such as an animation) sets them.
+			 *
+			 * @return true when the collider has a box.
+			*/
+			inline bool hasBox() {
+				return !mFitsGameObject || gameObject->mHalfSize.first > 0.0 || gameObject->mHalfSize.second > 0.0;
+			}
+
+			/**
+			 * @brief check if this collider sees the other one.
+			 *
+			 * @param other collider to be tested.
+			 *
+			 * @return true when the mask has the layer of the other collider.
+			*/
+			inline bool accepts(ColliderComponent &other) {
+				return (mMask & other.mLayer) != 0;
+			}
+
+			inline ColliderType getColliderType() {
+				return mColliderType;
+			}
+
+			inline bool isTrigger() {
+				return mTrigger;
+			}
+
+			inline void setTrigger(bool trigger) {
+				mTrigger = trigger;
+			}
+
+			inline unsigned int getLayer() {
+				return mLayer;
+			}
+
+			inline void setLayer(unsigned int layer) {
+				mLayer = layer;
+			}
+
+			inline unsigned int getMask() {
+				return mMask;
+			}
+
+			inline void setMask(unsigned int mask) {
+				mMask = mask;
+			}
+
+			/**
+			 * @brief access the game object of the collider.
+			 *
+			 * @return the game object the collider belongs to.
+			*/
+			inline GameObject &getGameObject() {
+				return *gameObject;
+			}
+
+			/**
+			 * @brief access the contacts of the last physics step.
+			 *
+			 * Only dynamic colliders get contacts.
+			 *
+			 * @return the contact manifold of the collider.
+			*/
+			inline ContactManifold &getContactManifold() {
+				return mContactManifold;
+			}
+
+			inline std::string getClassName() {
+				return "ColliderComponent";
+			}
+
+		private:
+			ColliderType mColliderType;
+			bool mFitsGameObject; // Box follows the game object measures, offset and size are unused.
+			std::pair<double, double> mOffset; // From the game object position to the box (pixels).
+			std::pair<double, double> mSize;
+			bool mTrigger = false;
+			unsigned int mLayer = 1;
+			unsigned int mMask = ALL_LAYERS;
+			ContactManifold mContactManifold;
+			// Kept by the physics world.
+			CollisionBox mLastBox; // Box on the last step, relative to the origin.
+			bool mHasLastBox = false;
+			std::vector<ColliderComponent *> mTouchingList; // Colliders touched on the last step.
+			std::vector<ColliderComponent *> mFoundList; // Colliders touched on this step.
+
+			friend class PhysicsWorld;
+	};
+}
+
+#endif
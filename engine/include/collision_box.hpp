@@ -0,0 +1,41 @@
+/**
+ * @file collision_box.hpp
+ * @brief Purpose: Contains the CollisionBox struct declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef COLLISION_BOX_HPP
+#define COLLISION_BOX_HPP
+
+namespace engine {
+
+	/**
+	 * @brief A SweepHit struct.
+	 *
+	 * Where a moving box first touched another one.
+	*/
+	struct SweepHit {
+		double time; // Fraction of the movement done before the touch, from 0 to 1.
+		int normalX; // -1 when the left side was hit, 1 for the right side, 0 otherwise.
+		int normalY; // -1 when the top was hit, 1 for the bottom, 0 otherwise.
+	};
+
+	/**
+	 * @brief A CollisionBox struct.
+	 *
+	 * Axis aligned box in canvas coordinates, where y grows downwards.
+	*/
+	struct CollisionBox {
+		double left;
+		double top;
+		double right;
+		double bottom;
+
+		bool sweep(double moveX, double moveY, const CollisionBox &target, SweepHit &hit) const;
+	};
+}
+
+#endif
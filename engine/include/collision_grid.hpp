@@ -0,0 +1,50 @@
+/**
+ * @file collision_grid.hpp
+ * @brief Purpose: Contains the CollisionGrid class declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef COLLISION_GRID_HPP
+#define COLLISION_GRID_HPP
+
+#include "log.h"
+#include <vector>
+
+namespace engine {
+
+	/**
+	 * @brief A CollisionGrid class.
+	 *
+	 * Broad phase for side scrolling levels: the x axis is split in cells of
+	 * the same width, and each interval is kept on every cell it touches. A
+	 * query only looks at the cells under it, so the narrow phase runs against
+	 * the nearby intervals instead of all of them. Coordinates before the
+	 * first cell or after the last one fall on the border cells.
+	 *
+	 * The cells follow the intervals: each fill starts on the lowest cell
+	 * of the last one, so a level of any length only keeps the cells
+	 * around its moving objects.
+	*/
+	class CollisionGrid {
+		public:
+			CollisionGrid(double cellWidth);
+
+			void clear();
+			void insert(unsigned int id, double left, double right);
+			void query(double left, double right, std::vector<unsigned int> &candidates);
+
+		private:
+			double mCellWidth;
+			std::vector<std::vector<unsigned int> > mCellList; // Ids on each cell, in insertion order.
+			unsigned int mFirstCell; // Cell of the x axis mCellList starts on.
+			unsigned int mLowestCell; // Lowest cell of the x axis inserted since the last clear.
+
+			unsigned int findCell(double x);
+			unsigned int findAxisCell(double x);
+	};
+}
+
+#endif
@@ -0,0 +1,71 @@
+/**
+ * @file collision_world.hpp
+ * @brief Purpose: Contains the CollisionWorld class declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef COLLISION_WORLD_HPP
+#define COLLISION_WORLD_HPP
+
+#include "log.h"
+#include "collision_box.hpp"
+#include <vector>
+
+namespace engine {
+
+	/**
+	 * @brief A CollisionWorld class.
+	 *
+	 * Static boxes kept as columns of floats (every min x, then every min y,
+	 * and so on), so a query box is tested against many of them at once:
+	 * 16 per step with AVX2, 8 with SSE2 and one at a time otherwise. The
+	 * float test may report a box that only touches the query box, so the
+	 * exact test must run on getBox afterwards. The columns are padded with
+	 * boxes that never overlap anything.
+	*/
+	class CollisionWorld {
+		public:
+			static const unsigned int BATCH_SIZE = 16; // Boxes in the widest step.
+
+			CollisionWorld();
+
+			void clear();
+			unsigned int addBox(const CollisionBox &box);
+			void findOverlaps(const CollisionBox &box, std::vector<unsigned int> &overlapList);
+
+			/**
+			 * @brief exact box added with an id.
+			 *
+			 * @param id value returned by addBox.
+			 *
+			 * @return the box, in double precision.
+			*/
+			inline const CollisionBox &getBox(unsigned int id) {
+				ASSERT(id < mBoxList.size(), "There's no box with this id.");
+				return mBoxList[id];
+			}
+
+			/**
+			 * @brief number of boxes added.
+			 *
+			 * @return how many boxes the world has.
+			*/
+			inline unsigned int getBoxCount() {
+				return mBoxList.size();
+			}
+
+		private:
+			std::vector<CollisionBox> mBoxList; // Exact boxes, indexed by id.
+			std::vector<float> mMinXList;
+			std::vector<float> mMinYList;
+			std::vector<float> mMaxXList;
+			std::vector<float> mMaxYList;
+
+			void padColumns();
+	};
+}
+
+#endif
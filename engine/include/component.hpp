@@ -25,6 +25,25 @@ namespace engine {
     */
 	class GameObject;
 
+	struct AssetList;
+
+	class StateBuffer;
+
+	class ColliderComponent;
+
+	/**
+     * @brief A collision event class.
+  	 *
+     * Tells whether two colliders started touching, kept touching or
+     * stopped touching on the last physics step. Triggers only report
+     * ENTER and EXIT, once each.
+    */
+	enum class CollisionEvent {
+		ENTER,
+		STAY,
+		EXIT
+	};
+
 	/**
      * @brief A component state class.
   	 *
@@ -43,14 +62,21 @@ namespace engine {
 	class Component {
 //T31
 	public:
+		static const unsigned int NO_POOL_INDEX = static_cast<unsigned int>(-1);
+
 		Component();
 		Component(GameObject &gameObject);
+		virtual ~Component();
 		virtual void init();
 		virtual void shutdown();
 		virtual void draw();
 		virtual void updateCode();
 		virtual void enableComponent();
 		virtual void disableComponent();
+		virtual void collectAssets(AssetList &assetList);
+		virtual void saveState(StateBuffer &stateBuffer);
+		virtual void loadState(StateBuffer &stateBuffer);
+		virtual void onCollision(CollisionEvent event, ColliderComponent &other);
 		bool isEnabled();
 
 		/**
@@ -63,10 +89,46 @@ namespace engine {
 		virtual inline std::string getClassName(){
 			return "Component";
 		}
+
+		inline GameObject *getGameObject(){
+			return gameObject;
+		}
+
 		protected:
 			GameObject *gameObject; // represents the object of the game
 			State componentState = State::ENABLED; // set the component state (based on enum class State)
 
+		private:
+			unsigned int mPoolIndex = NO_POOL_INDEX; // Position on the ComponentPool running the component.
+
+			template <class T>
+			friend class ComponentPool;
+
+	};
+
+	/**
+     * @brief A ComponentType class.
+  	 *
+     * Gives each component class a number of its own, counting from zero, so
+     * game objects find their components by indexing instead of asking each
+     * one for its type. A class gets its number the first time it's asked for
+     * and keeps it until the game closes.
+    */
+	class ComponentType {
+		public:
+			/**
+			 * @brief access the number of a component class.
+			 *
+			 * @return the number of T, the same on every call.
+			*/
+			template <class T>
+			static unsigned int getId(){
+				static const unsigned int typeId = sNextTypeId++;
+				return typeId;
+			}
+
+		private:
+			static unsigned int sNextTypeId; // Number of the next class asked for.
 	};
 }
 
@@ -0,0 +1,116 @@
+/**
+ * @file component_pool.hpp
+ * @brief Purpose: Contains the ComponentPool class declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef COMPONENT_POOL_HPP
+#define COMPONENT_POOL_HPP
+
+#include "component.hpp"
+#include "log.h"
+#include <vector>
+
+namespace engine {
+
+	/**
+	 * @brief A ComponentPool class.
+	 *
+	 * The running components of one type, one after the other, so a system
+	 * goes through all of them in a single loop instead of asking every game
+	 * object for its components. Each component keeps its position on the
+	 * pool: it's added and removed in constant time, the last one taking the
+	 * place of the removed one, so the order of the pool isn't the order the
+	 * components were added in.
+	*/
+	template <class T>
+	class ComponentPool {
+		public:
+			/**
+			 * @brief put a component on the pool.
+			 *
+			 * Components already on it are ignored.
+			 *
+			 * @param component component to be added.
+			 *
+			 * @return "void".
+			*/
+			void add(T &component) {
+				if (contains(component)) {
+					return;
+				} else {
+					//Nothing to do. The component goes at the end.
+				}
+
+				component.mPoolIndex = mComponentList.size();
+				mComponentList.push_back(&component);
+			}
+
+			/**
+			 * @brief take a component out of the pool.
+			 *
+			 * Components that aren't on it are ignored.
+			 *
+			 * @param component component to be removed.
+			 *
+			 * @return "void".
+			*/
+			void remove(T &component) {
+				if (!contains(component)) {
+					return;
+				} else {
+					//Nothing to do. The last component takes its place.
+				}
+
+				T *lastComponent = mComponentList.back();
+				mComponentList[component.mPoolIndex] = lastComponent;
+				lastComponent->mPoolIndex = component.mPoolIndex;
+				mComponentList.pop_back();
+				component.mPoolIndex = Component::NO_POOL_INDEX;
+			}
+
+			/**
+			 * @brief take every component out of the pool.
+			 *
+			 * The components aren't touched, they may be gone already: their
+			 * positions are only checked against the pool.
+			 *
+			 * @return "void".
+			*/
+			void clear() {
+				mComponentList.clear();
+			}
+
+			/**
+			 * @brief check if a component is on the pool.
+			 *
+			 * @param component component to be found.
+			 *
+			 * @return true when the component is on the pool.
+			*/
+			inline bool contains(T &component) {
+				return component.mPoolIndex < mComponentList.size() &&
+				       mComponentList[component.mPoolIndex] == &component;
+			}
+
+			inline unsigned int getSize() {
+				return mComponentList.size();
+			}
+
+			inline typename std::vector<T *>::iterator begin() {
+				return mComponentList.begin();
+			}
+
+			inline typename std::vector<T *>::iterator end() {
+				return mComponentList.end();
+			}
+
+		private:
+			std::vector<T *> mComponentList;
+	};
+}
+
+#endif
@@ -0,0 +1,45 @@
+/**
+ * @file component_systems.hpp
+ * @brief Purpose: Contains the ComponentSystems class declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef COMPONENT_SYSTEMS_HPP
+#define COMPONENT_SYSTEMS_HPP
+
+#include "component_pool.hpp"
+#include "animation.hpp"
+#include "audio_component.hpp"
+
+namespace engine {
+
+	/**
+	 * @brief A ComponentSystems class.
+	 *
+	 * Pools of the drawn and animated components of the running scene, and
+	 * the systems going through them. Components put themselves on their
+	 * pool on init and leave it on shutdown, like the colliders on the
+	 * physics world. Each system calls the method of its own type, so there's
+	 * no virtual call per component, and skips the disabled components and
+	 * the ones of disabled game objects.
+	*/
+	class ComponentSystems {
+		public:
+			ComponentPool<BackgroundComponent> mBackgroundPool;
+			ComponentPool<ImageComponent> mImagePool;
+			ComponentPool<Animation> mAnimationPool;
+			ComponentPool<AudioComponent> mAudioPool;
+
+			void clear();
+			void update();
+			void draw();
+
+		private:
+			bool isActive(Component &component);
+	};
+}
+
+#endif
@@ -0,0 +1,77 @@
+/**
+ * @file contact_manifold.hpp
+ * @brief Purpose: Contains the ContactManifold class declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef CONTACT_MANIFOLD_HPP
+#define CONTACT_MANIFOLD_HPP
+
+#include "game_object.hpp"
+#include "collision_box.hpp"
+
+namespace engine {
+
+	/**
+	 * @brief A Contact struct.
+	 *
+	 * One side of the body touching an object.
+	*/
+	struct Contact {
+		GameObject *object; // NULL when nothing touches this side.
+		double depth; // How far the body went into the object.
+		double surface; // Coordinate of the touched side of the object, 0 for triggers.
+	};
+
+	/**
+	 * @brief A ContactManifold class.
+	 *
+	 * Every contact of a body, gathered by testing it once against each
+	 * nearby object. Ground keeps the highest object found under the body,
+ * the other sides keep the first object found on them. Triggers
+	 * don't block the body, they're only listed, up to MAX_TRIGGERS of them.
+	 * Nothing is allocated, so a manifold can be filled on every frame.
+	*/
+	class ContactManifold {
+		public:
+			static const unsigned int MAX_TRIGGERS = 8;
+
+			Contact ground;
+			Contact ceiling;
+			Contact leftWall;
+			Contact rightWall;
+			Contact triggerList[MAX_TRIGGERS];
+			unsigned int triggerCount;
+
+			ContactManifold(double wallInsetX, double wallInsetY);
+
+			void clear();
+			bool addSolid(const CollisionBox &body, const CollisionBox &solid, GameObject *object);
+			bool addSweptSolid(const CollisionBox &body, double moveX, double moveY,
+			                   const CollisionBox &solid, GameObject *object);
+			bool addTrigger(const CollisionBox &body, const CollisionBox &trigger, GameObject *object);
+
+			/**
+			 * @brief how far right walls reach towards the body.
+			 *
+			 * Queries for the solids of a body must be this much wider.
+			 *
+			 * @return the wall inset on x.
+			*/
+			inline double getWallInsetX() {
+				return mWallInsetX;
+			}
+
+		private:
+			// Right walls reach this much further towards the body and start this much lower.
+			double mWallInsetX;
+			double mWallInsetY;
+
+			void setContact(Contact &contact, GameObject *object, double depth, double surface);
+	};
+}
+
+#endif
@@ -0,0 +1,49 @@
+/**
+  * @file frame_pacer.hpp
+  * @brief Purpose: Contains the FramePacer class declaration.
+  *
+  * GPL v3.0 License
+  * Copyright (c) 2017 Azo
+  *
+  * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+ */
+#ifndef FRAME_PACER_HPP
+#define FRAME_PACER_HPP
+
+#include "sdl2include.h"
+
+namespace engine {
+	/**
+	 * @brief A FramePacer class.
+	 *
+	 * Keeps the main loop at a steady frame rate. Frames end on deadlines
+	 * spaced by the frame period, so rounding errors don't pile up. The wait
+	 * sleeps while the deadline is far and spins for the last fraction of a
+	 * millisecond, since SDL_Delay can oversleep.
+	*/
+	class FramePacer {
+		private:
+			Uint64 framePeriod; // Time of each frame (nanoseconds), zero disables the pacing.
+			Uint64 deadline; // When the current frame must end (nanoseconds).
+			bool vsyncPacing; // The renderer present already waits for the display.
+		public:
+			FramePacer();
+			~FramePacer();
+
+			void setFrameRate(int frameRate);
+			void setVsync(bool vsync, int refreshRate, int frameRate);
+			void start();
+			void wait();
+
+			/**
+			 * @brief private attribute "vsyncPacing".
+			 *
+			 * @return true when the frames are paced by the display.
+			*/
+			inline bool isVsyncPacing() {
+				return vsyncPacing;
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,105 @@
+/**
+ * @file frame_statistics.hpp
+ * @brief Purpose: Contains the FrameHistogram and FrameStatistics classes declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef FRAME_STATISTICS_HPP
+#define FRAME_STATISTICS_HPP
+
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace engine {
+
+	const unsigned int HISTOGRAM_BINS = 1000; // Bins of HISTOGRAM_BIN_TIME, longer times only update the max.
+	const double HISTOGRAM_BIN_TIME = 0.1; // Resolution of the histogram (miliseconds).
+
+	/**
+	 * @brief A FrameHistogram class.
+	 *
+	 * Counts durations in fixed bins, so recording never allocates and the
+	 * percentiles cost the same however long the game runs.
+	*/
+	class FrameHistogram {
+		public:
+			FrameHistogram();
+
+			void record(double time);
+			double calcPercentile(double percentile);
+
+			/**
+			 * @brief longest time recorded.
+			 *
+			 * @return the longest time (miliseconds).
+			*/
+			inline double getMax() {
+				return mMax;
+			}
+
+		private:
+			unsigned int mBins[HISTOGRAM_BINS];
+			unsigned int mOverflow; // Times longer than the last bin.
+			unsigned int mCount;
+			double mMax;
+	};
+
+	/**
+	 * @brief A SceneStatistics struct.
+	 *
+	 * Frame times of one scene, split by phase.
+	*/
+	struct SceneStatistics {
+		FrameHistogram total; // Whole frame, waits included.
+		FrameHistogram update; // Scene updates.
+		FrameHistogram draw; // Recording and submitting the draws.
+		FrameHistogram present; // SDL_RenderPresent.
+		unsigned int frameCount = 0;
+		unsigned int hitchCount = 0; // Frames over the budget.
+		double totalTime = 0.0; // Sum of the frame times (miliseconds).
+		unsigned long culledDraws = 0; // Sum of the draws culled outside the viewport.
+	};
+
+	/**
+	 * @brief A FrameStatistics class.
+	 *
+	 * Collects the frame times of each scene and reports their percentiles,
+	 * hitches and average frame rate to a CSV or JSON file.
+	*/
+	class FrameStatistics {
+		public:
+			FrameStatistics();
+
+			void setScene(std::string sceneName);
+			void setFrameBudget(double frameBudget);
+			void recordFrame(double totalTime, double updateTime, double drawTime, double presentTime,
+			                 unsigned int culledDraws);
+			bool exportReport(std::string reportPath);
+			bool exportReport();
+
+			/**
+			 * @brief choose where "exportReport" writes when no path is given.
+			 *
+			 * @return "void".
+			*/
+			inline void setOutputPath(std::string outputPath) {
+				mOutputPath = outputPath;
+			}
+
+		private:
+			std::map<std::string, SceneStatistics> mSceneMap; // Statistics of every scene run.
+			SceneStatistics *mCurrentScene; // Statistics receiving the frames.
+			double mFrameBudget; // Frames longer than the budget are hitches (miliseconds).
+			std::string mOutputPath; // Report written by "exportReport()".
+
+		private:
+			void writeCsv(std::ostream &report);
+			void writeJson(std::ostream &report);
+	};
+}
+
+#endif
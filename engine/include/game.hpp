@@ -17,12 +17,21 @@
 #include "log.h"
 #include "scene.hpp"
 #include "timer.hpp"
+#include "frame_pacer.hpp"
+#include "render_queue.hpp"
+#include "frame_statistics.hpp"
 #include "sdl.hpp"
 #include "assets_manager.hpp"
 #include "input_manager.hpp"
+#include "physics_world.hpp"
+#include "component_systems.hpp"
+#include "camera.hpp"
 
 #include <string>
 #include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 
 namespace engine {
@@ -54,12 +63,19 @@ namespace engine {
 			Game();
 
 			void run();
+			void start();
+			bool runFrame();
+			void stop();
 			bool addScene(engine::Scene &scene);
 			void restartScene(std::string sceneName);
 			void setAttributes(std::string gameName,
 					   int windowWidth,
 					   int windowHeight,
 					   int frameRate);
+			void setSimulationRate(int simulationRate);
+			void setHeadless(bool headless, bool drawOffscreen);
+			void setFrameLimit(unsigned int frameLimit);
+			void setRenderThread(bool renderThread);
 
 			/**
 			 * @brief access the Timer.
@@ -83,21 +99,130 @@ namespace engine {
 				return assetsManager;
 			}
 
+			/**
+			 * @brief access the render queue.
+			 *
+			 * Components record their draws on it.
+			 *
+			 * @return the game render queue.
+			*/
+			inline RenderQueue& getRenderQueue(){
+				return renderQueue;
+			}
+
+			/**
+			 * @brief access the physics world.
+			 *
+			 * Colliders of the running scene are on it.
+			 *
+			 * @return the game physics world.
+			*/
+			inline PhysicsWorld& getPhysicsWorld(){
+				return physicsWorld;
+			}
+
+			/**
+			 * @brief access the component systems.
+			 *
+			 * Drawn and animated components of the running scene are on them.
+			 *
+			 * @return the game component systems.
+			*/
+			inline ComponentSystems& getComponentSystems(){
+				return componentSystems;
+			}
+
+			/**
+			 * @brief access the camera.
+			 *
+			 * Images and animations of the running scene are drawn from it.
+			 *
+			 * @return the game camera.
+			*/
+			inline Camera& getCamera(){
+				return camera;
+			}
+
+			/**
+			 * @brief access the frame statistics.
+			 *
+			 * Used to export the report on request.
+			 *
+			 * @return the game frame statistics.
+			*/
+			inline FrameStatistics& getFrameStatistics(){
+				return frameStatistics;
+			}
+
+			/**
+			 * @brief access the interpolation factor.
+			 *
+			 * Fraction of a simulation step left in the accumulator when the
+			 * current frame is drawn. It's always 1.0 when the fixed timestep
+			 * is disabled.
+			 *
+			 * @return the factor used to blend the last two simulation states.
+			*/
+			inline double getInterpolationFactor(){
+				return interpolationFactor;
+			}
+
 			void changeScene(std::string sceneName);
+			void prepareScene(std::string sceneName);
 
 		private:
 			bool needToChangeScene; // Used to define if there's a Change Scene to occur.
+			std::string nextSceneName; // Scene waiting for its assets to be loaded before the change.
 			std::map<std::string, Scene *> sceneMap; // All Scenes of the Game.
 			engine::Scene *currentScene; // Contain the Current Scene of the game.
 			engine::Scene *lastScene; // must contain the Last Scene of the game.
 			Timer timer; // Timer to control all Game's Time.
+			FramePacer framePacer; // Waits the end of each frame to keep the frame rate.
 			int frameRate; // Frames per Second of the Game (FPS).
-			float frameTime; // Time of each frame of the Game (miliseconds).
+			double frameTime; // Time of each frame of the Game (miliseconds).
+			int simulationRate; // Simulation steps per second, zero to simulate once per frame.
+			double simulationTime; // Time of each simulation step (miliseconds).
+			double accumulatedTime; // Frame time not yet consumed by simulation steps (miliseconds).
+			double interpolationFactor; // Blend between the last two simulation states when drawing.
+			bool headless; // Run without window and as fast as possible.
+			bool drawOffscreen; // Keep drawing into the offscreen canvas when headless.
+			unsigned int frameLimit; // Frames to run before exiting, zero runs until quit.
+			unsigned int frameCount; // Frames run since the main loop started.
+			Uint64 loopStartTime; // When the main loop started (nanoseconds), used to report the throughput.
+			RenderQueue renderQueue; // Draws recorded by the simulation, submitted by the main thread.
+			bool renderThread; // Simulate on a thread of its own.
+			std::thread simulationThread; // Runs "simulateFrame" when renderThread is set.
+			std::mutex simulationMutex; // Guards the simulation flags below.
+			std::condition_variable simulationCondition; // Signals changes on the simulation flags.
+			bool simulationRequested; // The main thread asked for a frame.
+			bool simulationFinished; // The simulation thread finished the requested frame.
+			bool simulationStopping; // The simulation thread must exit.
+			FrameStatistics frameStatistics; // Frame times of each scene.
+			double updateTime; // Spent on scene updates this frame (miliseconds).
+			double recordTime; // Spent recording the draws this frame (miliseconds).
+			double submitTime; // Spent submitting the draws this frame (miliseconds).
+			double presentTime; // Spent on SDL_RenderPresent this frame (miliseconds).
 			AssetsManager assetsManager; // Manager to load, unload and reference assets.
+			PhysicsWorld physicsWorld; // Colliders of the current scene, stepped before each update.
+			ComponentSystems componentSystems; // Drawn and animated components of the current scene.
+			Camera camera; // Part of the world of the current scene seen on the screen.
 
 
 		private:
 			bool startAndStopScenes();
+			void updatePreparation();
+			void handleEvents();
+			void runVariableFrame();
+			void runFixedFrame();
+			void drawFrame();
+			void presentFrame();
+			void simulateFrame();
+			void simulationLoop();
+			void requestSimulation();
+			void waitSimulation();
+			void runThreadedFrame();
+			void runSerialFrame();
+			void reportThroughput(double elapsedTime);
 
 	};
 }
@@ -14,9 +14,7 @@
 #define gameObject_HPP
 
 #include <iostream>
-#include <typeinfo>
-#include <typeindex>
-#include <unordered_map>
+#include <vector>
 #include <list>
 
 #include "animation.hpp"
@@ -24,6 +22,7 @@
 #include "component.hpp"
 #include "animation_controller.hpp"
 #include "audio_controller.hpp"
+#include "arena.hpp"
 
 namespace engine {
 
@@ -45,25 +44,95 @@ namespace engine {
 	class GameObject {
 
 		public:
-			std::pair<double, double> mCurrentPosition; // Game object's left upper corner coordinates.
+			std::pair<double, double> mCurrentPosition; // Game object's left upper corner coordinates, on the world.
+			std::pair<double, double> mPreviousPosition; // Left upper corner on the last simulation step.
 			std::pair<double, double> mSize; // Pair that contains X and Y sizes, respectively.
 			std::pair<double, double> mCenter; // Center position of game object.
 			std::pair<double, double> mHalfSize; // Pair of half size of game object.
 			std::list<GameObject *> mParentList; // All parents of game object
 			std::string mName; // Name of game object
 			ObjectState mObjectState = ObjectState::ENABLED; // Sets the game object state
+			int mLayer = 0; // Draw order, lower layers are drawn first.
+			unsigned int mDrawOrder = 0; // Position on its scene, draws on the same layer follow it.
+			bool mFixedOnScreen = false; // Drawn where it is on the screen, the camera doesn't move it.
 
 		public:
 			GameObject();
 			GameObject(std::string gameObjectName,
 					std::pair<double, double> currentPosition);
-			void addComponent(Component &component);
-			AnimationController* getAnimationController(std::type_index componentType);
-			AudioController* getAudioController(std::type_index componentType);
+			virtual ~GameObject();
+
+			/**
+			 * @brief add a component built by its owner.
+			 *
+			 * The component is found by the type it's added as, its owner
+			 * still shuts it down and deletes it.
+			 *
+			 * @param component component to be added.
+			 *
+			 * @return "void".
+			*/
+			template <class T>
+			void addComponent(T &component){
+				registerComponent(component, ComponentType::getId<T>());
+			}
+
+			/**
+			 * @brief build a component and add it.
+			 *
+			 * The component is built with "create", so it's freed with the
+			 * game object. It's still shut down by the game object code,
+			 * like the components added by their owners.
+			 *
+			 * @param arguments passed to the constructor of the component.
+			 *
+			 * @return the new component.
+			*/
+			template <class T, class... Arguments>
+			T *addComponent(Arguments&&... arguments){
+				T *component = create<T>(static_cast<Arguments&&>(arguments)...);
+				registerComponent(*component, ComponentType::getId<T>());
+				return component;
+			}
+
+			/**
+			 * @brief build a part of the game object, such as a component or a sprite.
+			 *
+			 * It's placed on the arena of the game object and lives as long
+			 * as the arena does, it mustn't be deleted.
+			 *
+			 * @param arguments passed to the constructor of the part.
+			 *
+			 * @return the new part.
+			*/
+			template <class T, class... Arguments>
+			T *create(Arguments&&... arguments){
+				return getArena().create<T>(static_cast<Arguments&&>(arguments)...);
+			}
+
+			/**
+			 * @brief find the first component added as a type.
+			 *
+			 * @return the component, or NULL when there's none of the type.
+			*/
+			template <class T>
+			T *getComponent(){
+				unsigned int typeId = ComponentType::getId<T>();
+
+				if (typeId < mComponentTypeList.size()){
+					return static_cast<T *>(mComponentTypeList[typeId]);
+				} else {
+					return NULL;
+				}
+			}
+
 			virtual void init();
-			virtual void draw();
 			virtual void shutdown();
 			virtual void updateCode();
+			void collectAssets(AssetList &assetList);
+			virtual void saveState(StateBuffer &stateBuffer);
+			virtual void loadState(StateBuffer &stateBuffer);
+			void onCollision(CollisionEvent event, ColliderComponent &other);
 			virtual inline std::string getClassName(){ return "GameObject";}
 			std::pair<double, double> calcBottomLeft();
 			std::pair<double, double> calcBottomRight();
@@ -73,9 +142,37 @@ namespace engine {
 			std::pair<double, double> calcRightDown();
 			std::pair<double, double> calcLeftUp();
 			std::pair<double, double> calcLeftDown();
+			void storePreviousPosition();
+			std::pair<double, double> calcInterpolatedPosition(double interpolationFactor);
+			std::pair<double, double> calcScreenPosition(double interpolationFactor);
+			void setParent(GameObject *parent);
+			void setLocalPosition(std::pair<double, double> localPosition);
+			const std::pair<double, double> &getWorldPosition();
+
+			inline GameObject *getParent(){
+				return mTransformParent;
+			}
+
+			inline std::pair<double, double> getLocalPosition(){
+				return mLocalPosition;
+			}
 
 		protected:
-			std::unordered_multimap<std::type_index, Component *> mComponentMap; // Component that represents game object's map.
+			std::vector<Component *> mComponentList; // Components of the game object, in the order they were added.
+
+			void setArena(Arena &arena);
+
+		private:
+			void registerComponent(Component &component, unsigned int typeId);
+			Arena &getArena();
+
+			std::vector<Component *> mComponentTypeList; // First component of each type, by ComponentType number.
+			Arena *mArena = NULL; // Where the parts are built, NULL until the first one or "setArena".
+			bool mOwnsArena = false; // mArena was built for the game object alone, it's deleted with it.
+			GameObject *mTransformParent = NULL; // Game object the position is relative to, NULL for the world.
+			std::pair<double, double> mLocalPosition; // Position relative to mTransformParent.
+			std::pair<double, double> mResolvedParentPosition; // Parent position mCurrentPosition was resolved from.
+			bool mTransformDirty = true; // The local position or the parent changed since the last resolution.
 	};
 
 }
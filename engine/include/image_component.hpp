@@ -32,6 +32,8 @@ namespace engine {
 		);
 
 	protected:
+		void loadImage();
+
 		double zoomFactor;
 		SDL_Rect canvasQuad;
 		std::pair<double, double> mPositionRelativeToObject = std::make_pair(0.0, 0.0);
@@ -41,6 +43,7 @@ namespace engine {
 		virtual ~ImageComponent();
 
 		void init();
+		void shutdown();
 		void draw();
 		void updateQuad();
 		inline std::string getClassName() {
@@ -42,14 +42,20 @@ namespace engine {
 			unsigned int mLastEventType;
 			std::list<SDL_Event> mEventList;
 			const Uint8 *keyboardStates;
+			Uint8 mScriptedStates[SDL_NUM_SCANCODES]; // Keyboard states set by "pressKey" and "releaseKey".
+			bool mScripted; // Keys come from a script instead of the keyboard.
 		public:
 			InputManager();
 			~InputManager();
+			void init();
 			void update(SDL_Event _event);
 			bool keyDown(Button button);
 			bool keyDownOnce(Button button);
 			bool keyState(Button button);
 			void clear();
+			void setScripted(bool scripted);
+			void pressKey(Button button);
+			void releaseKey(Button button);
 	};
 }
 
@@ -0,0 +1,84 @@
+/**
+ * @file level_streamer.hpp
+ * @brief Purpose: Contains the LevelStreamer class declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef LEVEL_STREAMER_HPP
+#define LEVEL_STREAMER_HPP
+
+#include "log.h"
+
+namespace engine {
+
+	/**
+	 * @brief A ChunkLoader class.
+	 *
+	 * Builds and takes down the chunks of a streamed level, when the
+	 * LevelStreamer asks for them.
+	*/
+	class ChunkLoader {
+		public:
+			virtual ~ChunkLoader() {}
+
+			virtual void loadChunk(unsigned int chunk) = 0;
+			virtual void releaseChunk(unsigned int chunk) = 0;
+	};
+
+	/**
+	 * @brief A LevelStreamer class.
+	 *
+	 * Splits a horizontal level into chunks of the same width, numbered from
+	 * its left side. Only the chunks seen by the camera, the ones ahead of it
+	 * and the ones just behind it are loaded: chunks are loaded as they enter
+	 * that window and released as they leave it, so no more than
+	 * "getMaxLoadedChunks" are ever loaded, whatever the level length.
+	*/
+	class LevelStreamer {
+		public:
+			LevelStreamer(ChunkLoader &chunkLoader, double chunkWidth, unsigned int chunksBehind, unsigned int chunksAhead);
+
+			void setChunkCount(unsigned int chunkCount);
+			unsigned int getChunk(double position);
+			unsigned int getMaxLoadedChunks(double viewWidth);
+			unsigned int getLoadedEnd(double viewLeft, double viewWidth);
+			void update(double viewLeft, double viewWidth);
+			void releaseAll();
+
+			/**
+			 * @brief check if a chunk is loaded.
+			 *
+			 * @param chunk number of the chunk.
+			 *
+			 * @return true when the chunk is loaded.
+			*/
+			inline bool isLoaded(unsigned int chunk) {
+				return chunk >= mFirstLoaded && chunk < mLoadedEnd;
+			}
+
+			inline unsigned int getChunkCount() {
+				return mChunkCount;
+			}
+
+			inline double getChunkWidth() {
+				return mChunkWidth;
+			}
+
+		private:
+			ChunkLoader *mChunkLoader;
+			double mChunkWidth; // Pixels.
+			unsigned int mChunksBehind; // Chunks kept loaded behind the camera.
+			unsigned int mChunksAhead; // Chunks loaded ahead of the camera.
+			unsigned int mChunkCount;
+			unsigned int mFirstLoaded; // The loaded chunks go from mFirstLoaded up to mLoadedEnd, excluded.
+			unsigned int mLoadedEnd;
+
+			LevelStreamer(const LevelStreamer &);
+			LevelStreamer &operator=(const LevelStreamer &);
+	};
+}
+
+#endif
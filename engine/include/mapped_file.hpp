@@ -0,0 +1,63 @@
+/**
+ * @file mapped_file.hpp
+ * @brief Purpose: Contains the MappedFile class declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace engine {
+
+	/**
+	 * @brief A MappedFile class.
+	 *
+	 * Read only view of a whole file. On POSIX systems the file is mapped
+	 * into memory, so its pages are only read when they're touched and
+	 * nothing is copied; elsewhere it's read into a buffer.
+	*/
+	class MappedFile {
+		public:
+			MappedFile();
+			~MappedFile();
+
+			bool open(std::string path);
+			void close();
+
+			/**
+			 * @brief access the bytes of the file.
+			 *
+			 * @return the first byte, NULL when no file is open.
+			*/
+			inline const unsigned char *getData() {
+				return mData;
+			}
+
+			/**
+			 * @brief measure the file.
+			 *
+			 * @return size of the file (bytes), 0 when no file is open.
+			*/
+			inline std::size_t getSize() {
+				return mSize;
+			}
+
+		private:
+			const unsigned char *mData; // Start of the file in memory.
+			std::size_t mSize;
+			bool mMapped; // mData was mapped, instead of read into mBuffer.
+			std::vector<unsigned char> mBuffer;
+
+			MappedFile(const MappedFile &);
+			MappedFile &operator=(const MappedFile &);
+	};
+}
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ * @file physics_world.hpp
+ * @brief Purpose: Contains the PhysicsWorld class declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef PHYSICS_WORLD_HPP
+#define PHYSICS_WORLD_HPP
+
+#include "collider_component.hpp"
+#include "collision_world.hpp"
+#include "collision_grid.hpp"
+#include <vector>
+
+namespace engine {
+
+	/**
+	 * @brief A collision event waiting to be delivered.
+	*/
+	struct CollisionEventEntry {
+		CollisionEvent event;
+		ColliderComponent *receiver; // NULL when it was removed before the delivery.
+		ColliderComponent *other;
+	};
+
+	/**
+	 * @brief A PhysicsWorld class.
+	 *
+	 * Colliders of the running scene, stepped by the game before each update.
+	 * Static solids are indexed once on a CollisionWorld: levels stay still
+	 * on the world and the camera scrolls over them. Scenes that move a
+	 * whole game object instead, like the benchmark stress level, may set it
+	 * as the origin so its solids follow it. Dynamic colliders and triggers
+	 * are put on a CollisionGrid on every step. Each dynamic
+	 * collider is swept against the solids along its movement since the last
+	 * step, and its ContactManifold gets what it touches: the game code
+	 * decides how to resolve those contacts. Game objects are told when two
+	 * colliders start, keep and stop touching, once every collider was tested.
+	*/
+	class PhysicsWorld {
+		public:
+			PhysicsWorld();
+
+			void clear();
+			void addCollider(ColliderComponent &collider);
+			void removeCollider(ColliderComponent &collider);
+			void setOrigin(GameObject *origin);
+			void step();
+
+		private:
+			std::vector<ColliderComponent *> mSolidList; // Static solids, indexed by their ids on mCollisionWorld.
+			std::vector<ColliderComponent *> mColliderList; // Dynamic colliders and triggers, indexed by their ids on mCollisionGrid.
+			std::vector<CollisionBox> mBoxList; // Box of each collider of mColliderList on this step, relative to the origin.
+			bool mSolidsChanged; // mCollisionWorld must be rebuilt before the next step.
+			CollisionWorld mCollisionWorld;
+			CollisionGrid mCollisionGrid;
+			std::vector<unsigned int> mCandidateList; // Ids found by the last query.
+			GameObject *mOrigin; // Game object at the origin, NULL for the world itself.
+			std::pair<double, double> mOriginPosition; // Position of the origin on this step.
+			std::vector<CollisionEventEntry> mEventList; // Events of this step, delivered after it.
+
+			void indexSolids();
+			void indexColliders();
+			void findContacts(unsigned int id);
+			void notifyContacts(ColliderComponent &collider);
+			void queueEvent(CollisionEvent event, ColliderComponent &receiver, ColliderComponent &other);
+			void deliverEvents();
+			bool isActive(ColliderComponent &collider);
+			CollisionBox shiftBox(const CollisionBox &box, double shiftX, double shiftY);
+	};
+}
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * @file profiler.hpp
+ * @brief Purpose: Contains the Profiler class declaration and the PROFILE_SCOPE macro.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include "sdl2include.h"
+#include <atomic>
+#include <string>
+#include <vector>
+
+// Compiled out with NPROFILE, the profiler isn't even built.
+#ifndef NPROFILE
+namespace engine {
+
+	/**
+	 * @brief A ProfileEvent struct.
+	 *
+	 * One timed section of a frame. Times are raw performance counter values,
+	 * converted only when the trace is exported.
+	*/
+	struct ProfileEvent {
+		const char *name; // Must be a string literal, it isn't copied.
+		Uint64 start;
+		Uint64 end;
+		SDL_threadID threadId;
+	};
+
+	/**
+	 * @brief A Profiler class.
+	 *
+	 * Records the timed sections into a ring buffer allocated once, so
+	 * recording never allocates and only the newest events are kept.
+	 * The events can be exported to the chrome://tracing JSON format.
+	*/
+	class Profiler {
+		public:
+			static Profiler instance; // Global profiler instance.
+
+		public:
+			Profiler();
+			~Profiler();
+
+			/**
+			 * @brief store a timed section.
+			 *
+			 * @param name string literal naming the section.
+			 * @param start performance counter when the section began.
+			 * @param end performance counter when the section ended.
+			 *
+			 * @return "void".
+			*/
+			inline void record(const char *name, Uint64 start, Uint64 end) {
+				if(enabled) {
+					ProfileEvent &event = mEvents[mNextEvent++ % mEvents.size()];
+					event.name = name;
+					event.start = start;
+					event.end = end;
+					event.threadId = SDL_ThreadID();
+				} else {
+					//Nothing to do. The profiler is paused.
+				}
+			}
+
+			bool exportTrace(std::string tracePath);
+			bool exportTrace();
+			void clear();
+
+			/**
+			 * @brief pause or resume the recording.
+			 *
+			 * @return "void".
+			*/
+			inline void setEnabled(bool enabled) {
+				this->enabled = enabled;
+			}
+
+			/**
+			 * @brief choose where "exportTrace" writes when no path is given.
+			 *
+			 * @return "void".
+			*/
+			inline void setOutputPath(std::string outputPath) {
+				mOutputPath = outputPath;
+			}
+
+		private:
+			std::vector<ProfileEvent> mEvents; // Ring buffer of the recorded events.
+			std::atomic<unsigned long> mNextEvent; // Total events recorded, the next slot is this modulo the size.
+			std::string mOutputPath; // Trace file written by "exportTrace()".
+			bool enabled;
+	};
+
+	/**
+	 * @brief A ProfileScope class.
+	 *
+	 * Records the time between its construction and destruction.
+	 * Use it through the PROFILE_SCOPE macro.
+	*/
+	class ProfileScope {
+		public:
+			inline ProfileScope(const char *name) {
+				mName = name;
+				mStart = SDL_GetPerformanceCounter();
+			}
+
+			inline ~ProfileScope() {
+				Profiler::instance.record(mName, mStart, SDL_GetPerformanceCounter());
+			}
+
+		private:
+			const char *mName;
+			Uint64 mStart;
+	};
+}
+#endif
+
+// Generating macro of the NPROFILE.
+#ifndef NPROFILE
+#   define PROFILE_CONCAT_INNER(first, second) first ## second
+#   define PROFILE_CONCAT(first, second) PROFILE_CONCAT_INNER(first, second)
+#   define PROFILE_SCOPE(name) \
+	engine::ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#else
+#   define PROFILE_SCOPE(name)
+#endif
+
+#endif
@@ -0,0 +1,72 @@
+/**
+ * @file render_queue.hpp
+ * @brief Purpose: Contains the RenderQueue class declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef RENDER_QUEUE_HPP
+#define RENDER_QUEUE_HPP
+
+#include "sdl2include.h"
+#include <vector>
+
+namespace engine {
+
+	/**
+	 * @brief A RenderCommand struct.
+	 *
+	 * Everything needed to copy a texture to the canvas later.
+	*/
+	struct RenderCommand {
+		SDL_Texture *texture;
+		SDL_Rect source; // Part of the texture to copy.
+		SDL_Rect destination; // Where it goes on the canvas.
+		bool wholeCanvas; // Destination is the whole canvas (NULL on SDL_RenderCopy).
+		int layer; // Lower layers are drawn first.
+		unsigned int order; // Then lower orders, the draw order of the game object.
+		unsigned int sequence; // Then the order it was recorded in.
+	};
+
+	/**
+	 * @brief A RenderQueue class.
+	 *
+	 * Components record their draws here instead of calling SDL_RenderCopy.
+	 * Commands are written to the back list and submitted from the front one,
+	 * so a frame can be recorded while the previous one is submitted. The
+	 * queue itself isn't locked: the lists must only be swapped when nobody
+	 * is recording or submitting. Copies entirely outside the viewport are
+	 * culled when recorded, so they never reach SDL_RenderCopy.
+	*/
+	class RenderQueue {
+		public:
+			RenderQueue();
+			~RenderQueue();
+
+			void push(SDL_Texture *texture, const SDL_Rect &source,
+			          const SDL_Rect *destination, int layer, unsigned int order);
+			void swap();
+			void submit(SDL_Renderer *canvas);
+			void clear();
+			void setViewport(const SDL_Rect &viewport);
+
+			/**
+			 * @brief copies culled on the last frame recorded.
+			 *
+			 * @return how many copies were outside the viewport.
+			*/
+			inline unsigned int getCulledCount() {
+				return mCulledCounts[1 - mBackList];
+			}
+
+		private:
+			std::vector<RenderCommand> mCommandLists[2];
+			unsigned int mCulledCounts[2]; // Copies culled while recording each list.
+			int mBackList; // Index of the list being recorded.
+			SDL_Rect mViewport; // Visible part of the canvas, culling is off while it's empty.
+	};
+}
+
+#endif
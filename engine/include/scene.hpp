@@ -12,8 +12,11 @@
 
 #include <iostream>
 #include <unordered_map>
+#include <vector>
 #include "sdl2include.h"
 #include "game_object.hpp"
+#include "state_buffer.hpp"
+#include "arena.hpp"
 
 namespace engine {
 
@@ -40,6 +43,8 @@ namespace engine {
 		NO_MATCHING_FILE
 	};
 
+	typedef unsigned int GameObjectHandle; // Position of a game object in the scene, valid until the scene is cleared.
+
 	/*
 	 *@brief a Scene class
 	 *
@@ -48,12 +53,16 @@ namespace engine {
 	class Scene {
 	public:
 		engine::GameObject & getGameObject(std::string & gameObjectName);
+		engine::GameObject & getGameObject(GameObjectHandle handle);
 		SceneState mState = SceneState::FIRST_TIME;
 		
 	protected:
-		std::map<std::string, engine::GameObject *> gameObjectMap;
-		std::list<std::string> mKeyList;
+		std::map<std::string, engine::GameObject *> gameObjectMap; // Game objects by name, only for lookups.
+		std::vector<engine::GameObject *> mGameObjectList; // Game objects of the scene in order, NULL where removed.
 		std::string sceneName;
+		bool snapshotEnabled = false; // Restart by restoring the snapshot instead of "restart".
+		StateBuffer mSnapshot; // State of every game object right after init.
+		Arena mArena; // Game objects of the scene and their parts, released on shutdown.
 
 	public:
 		Scene();
@@ -64,14 +73,30 @@ namespace engine {
 		virtual void draw();
 		virtual void updateCode();
 		virtual void restart();
+		void storePreviousPositions();
+		virtual void collectAssets(AssetList &assetList);
+		void saveSnapshot();
+		virtual void restoreSnapshot();
+
+		/**
+		 * @brief check if the scene can restart from its snapshot.
+		 *
+		 * @return true when a snapshot was saved since the last shutdown.
+		*/
+		inline bool hasSnapshot() {
+			return snapshotEnabled && mSnapshot.isEmpty() == false;
+		}
 
 		inline std::string getSceneName() {
 			return sceneName;
 		}
 
 		void deleteKeyList();
-		void addGameObject(engine::GameObject &gameObject);
+		GameObjectHandle addGameObject(engine::GameObject &gameObject);
+		GameObjectHandle reserveGameObjects(unsigned int count);
+		void placeGameObject(GameObjectHandle handle, engine::GameObject &gameObject);
 		void removeGameObject(std::string &gameObjectName);
+		void removeGameObject(GameObjectHandle handle);
 		void errorLog(ErrorTypeScene code, std::string file);
 	};
 }
@@ -28,9 +28,11 @@ namespace engine {
 		private:
 			SDL_Window *window;
 			SDL_Renderer *canvas;
+			SDL_Surface *offscreenSurface; // Target of the software canvas when running headless.
 			int windowWidth;
 			int windowHeight;
 			std::string gameName;
+			bool headless; // Run without window, GPU renderer or audio device.
 		public:
 			SDL();
 
@@ -41,6 +43,24 @@ namespace engine {
 			*/
 			void setSDLAttributes(std::string gameName, int windowWidth, int windowHeight);
 
+			/**
+			 * @brief choose to run without window, GPU renderer or audio device.
+			 *
+			 * Must be called before "initSDL".
+			 *
+			 * @return "void".
+			*/
+			void setHeadless(bool headless);
+
+			/**
+			 * @brief private attribute "headless".
+			 *
+			 * @return "headless".
+			*/
+			inline bool isHeadless() {
+				return headless;
+			}
+
 			/**
 			 * @brief initialize all SDL.
 			 *
@@ -70,6 +90,29 @@ namespace engine {
 		    */
 			void createWindow();
 
+			/**
+			 * @brief creating an offscreen Canvas.
+			 *
+			 * Used inside "createWindow" when running headless.
+			 *
+			 * @return "void".
+			*/
+			void createOffscreenCanvas();
+
+			/**
+			 * @brief check if the canvas presents with vsync.
+			 *
+			 * @return true when "SDL_RenderPresent" waits for the display.
+			*/
+			bool hasVsync();
+
+			/**
+			 * @brief refresh rate of the display showing the window.
+			 *
+			 * @return the refresh rate (Hz), zero when unknown.
+			*/
+			int getRefreshRate();
+
 			/**
 			 * @brief terminating SDL.
 			 *
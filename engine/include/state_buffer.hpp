@@ -0,0 +1,97 @@
+/**
+ * @file state_buffer.hpp
+ * @brief Purpose: Contains the StateBuffer class declaration.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef STATE_BUFFER_HPP
+#define STATE_BUFFER_HPP
+
+#include "log.h"
+#include <vector>
+#include <utility>
+#include <cstring>
+
+namespace engine {
+
+	/**
+	 * @brief A StateBuffer class.
+	 *
+	 * Plain bytes where game objects and components write their mutable state,
+	 * to read it back later in the same order. Values are copied byte by byte,
+	 * so only plain values (numbers, enums, pointers) may be written. Reading
+	 * doesn't allocate.
+	*/
+	class StateBuffer {
+		public:
+			StateBuffer();
+
+			/**
+			 * @brief append a value to the buffer.
+			 *
+			 * @param value plain value to copy.
+			 *
+			 * @return "void".
+			*/
+			template <typename T>
+			inline void write(const T &value){
+				const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&value);
+				mData.insert(mData.end(), bytes, bytes + sizeof(T));
+			}
+
+			/**
+			 * @brief append a pair to the buffer, one member after the other.
+			 *
+			 * @param value pair to copy.
+			 *
+			 * @return "void".
+			*/
+			template <typename T, typename U>
+			inline void write(const std::pair<T, U> &value){
+				write(value.first);
+				write(value.second);
+			}
+
+			/**
+			 * @brief read the next value of the buffer.
+			 *
+			 * @param value receives the value.
+			 *
+			 * @return "void".
+			*/
+			template <typename T>
+			inline void read(T &value){
+				ASSERT(mReadPosition + sizeof(T) <= mData.size(), "Can't read past the end of the state buffer.");
+				std::memcpy(&value, &mData[mReadPosition], sizeof(T));
+				mReadPosition += sizeof(T);
+			}
+
+			/**
+			 * @brief read the next pair of the buffer.
+			 *
+			 * @param value receives the pair.
+			 *
+			 * @return "void".
+			*/
+			template <typename T, typename U>
+			inline void read(std::pair<T, U> &value){
+				read(value.first);
+				read(value.second);
+			}
+
+			void clear();
+			void rewind();
+			bool isEmpty();
+			bool isAtEnd();
+			unsigned long getSize();
+
+		private:
+			std::vector<unsigned char> mData; // State written so far.
+			unsigned long mReadPosition; // Where the next read starts.
+	};
+}
+
+#endif
@@ -13,20 +13,23 @@
 #include "sdl2include.h"
 
 namespace engine {
-	//@brief class to calculate time operations	 
+	//@brief class to calculate time operations with the high resolution counter
 	class Timer {
 		private:
-			unsigned int startTicks;
-			unsigned int elapsedTicks;
-			float deltaTime;
+			Uint64 stepCounter; // Performance counter value of the last step.
+			double deltaTime; // Time between the last two steps (miliseconds).
 		public:
 			Timer();
 			~Timer();
 
 			void step();
 			void Reset();
-			void DeltaTime();
-			float getDeltaTime();
+			double getElapsedTime();
+			double getDeltaTime();
+			void setDeltaTime(double deltaTime);
+
+			static Uint64 getNanoseconds();
+			static double getMilliseconds();
 	};
 }
 
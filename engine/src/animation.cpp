@@ -12,6 +12,7 @@
 */
 #include "animation.hpp"
 #include "game.hpp"
+#include "state_buffer.hpp"
 
 using namespace engine;
 
@@ -94,16 +95,16 @@ Animation::Animation(
 
 Animation::~Animation() {}
 
+void Animation::init() {
+	DEBUG("Calling Animation::init");
+	loadImage();
+	Game::instance.getComponentSystems().mAnimationPool.add(*this);
+}
+
 void Animation::shutdown() {
 	DEBUG("Shutting down Animation");
-	if (mSpriteList.size() > 0) {
-		for (auto eachSprite : mSpriteList) {
-			delete(eachSprite);
-			eachSprite = NULL;
-		}
-	} else {
-		//Nothing to do
-	}
+	// The sprites are built with the game object, they're freed with it.
+	Game::instance.getComponentSystems().mAnimationPool.remove(*this);
 }
 
 void Animation::draw() {
@@ -111,14 +112,23 @@ void Animation::draw() {
 
 	checkLimits();
 	updateQuad();
-	updateGameObjectMeasures();
-	SDL_RenderCopy(
-		Game::instance.sdlElements.getCanvas(),
+	Game::instance.getRenderQueue().push(
 		imageTexture,
-		&renderQuad,
-		&canvasQuad
+		renderQuad,
+		&canvasQuad,
+		gameObject->mLayer,
+		gameObject->mDrawOrder
 	);
+}
+
+void Animation::updateAnimation() {
+	//DEBUG("Updating Animation");
+
+	// Frames advance with the simulation, so the sprite (and the game object
+	// measures taken from it) don't depend on how often the scene is drawn.
 	updateFrameBasedOntime();
+	checkLimits();
+	updateGameObjectMeasures();
 }
 
 void Animation::disableComponent() {
@@ -129,6 +139,22 @@ void Animation::disableComponent() {
 	mCurrentSprite = mStartFrame;
 }
 
+void Animation::saveState(StateBuffer &stateBuffer) {
+	Component::saveState(stateBuffer);
+	stateBuffer.write(mState);
+	stateBuffer.write(mCurrentSprite);
+	stateBuffer.write(mCurrentAnimationTime);
+	stateBuffer.write(renderQuad);
+}
+
+void Animation::loadState(StateBuffer &stateBuffer) {
+	Component::loadState(stateBuffer);
+	stateBuffer.read(mState);
+	stateBuffer.read(mCurrentSprite);
+	stateBuffer.read(mCurrentAnimationTime);
+	stateBuffer.read(renderQuad);
+}
+
 void Animation::checkLimits() {
 	//DEBUG("Checking Animation Limits");
 
@@ -154,10 +180,14 @@ void Animation::updateQuad() {
 		mSpriteList[mCurrentSprite]->getSpriteHeight()
 	};
 
+	std::pair<double, double> drawPosition = gameObject->calcScreenPosition(
+		Game::instance.getInterpolationFactor()
+	);
+
 	//Updating canvas quad.
 	canvasQuad = {
-		(int)(gameObject->mCurrentPosition.first + mPositionRelativeToObject.first),
-		(int)(gameObject->mCurrentPosition.second + mPositionRelativeToObject.second),
+		(int)(drawPosition.first + mPositionRelativeToObject.first),
+		(int)(drawPosition.second + mPositionRelativeToObject.second),
 		(int)(mSpriteList[mCurrentSprite]->getSpriteWidth() * zoomFactor),
 		(int)(mSpriteList[mCurrentSprite]->getSpriteHeight() * zoomFactor),
 	};
@@ -186,9 +216,11 @@ void Animation::updateGameObjectMeasures() {
 	gameObject->mHalfSize.second
 	= mSpriteList[mCurrentSprite]->getSpriteHeight() * zoomFactor / DIVISOR_NUMBER;
 
+	const std::pair<double, double> &position = gameObject->getWorldPosition();
+
 	gameObject->mCenter.first
-	= gameObject->mCurrentPosition.first + gameObject->mHalfSize.first;
+	= position.first + gameObject->mHalfSize.first;
 
 	gameObject->mCenter.second
-	= gameObject->mCurrentPosition.second + gameObject->mHalfSize.second;
+	= position.second + gameObject->mHalfSize.second;
 }
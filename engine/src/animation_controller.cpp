@@ -11,6 +11,7 @@
 * This file implements the main game component its declaration and state.
 */
 #include "animation_controller.hpp"
+#include "state_buffer.hpp"
 
 using namespace engine;
 
@@ -35,31 +36,43 @@ void AnimationController::init() {
 	}
 }
 
-void AnimationController::shutdown() {
-	//DEBUG("Shutting down AnimationController");
+void AnimationController::collectAssets(AssetList &assetList) {
 	for (auto animationRow : mAnimationMap) {
 		auto animation = animationRow.second;
-		ASSERT(
-			animation != NULL,
-			"AnimationController::shutdown, animation map can't be null"
-		);
-		animation->shutdown();
+		ASSERT(animation != NULL, "animation can't be null");
+		animation->collectAssets(assetList);
 	}
 }
 
-void AnimationController::draw() {
-	//DEBUG("Drawing AnimationController");
+void AnimationController::saveState(StateBuffer &stateBuffer) {
+	Component::saveState(stateBuffer);
+
+	for (auto animationRow : mAnimationMap) {
+		auto animation = animationRow.second;
+		ASSERT(animation != NULL, "animation can't be null");
+		animation->saveState(stateBuffer);
+	}
+}
+
+void AnimationController::loadState(StateBuffer &stateBuffer) {
+	Component::loadState(stateBuffer);
+
+	for (auto animationRow : mAnimationMap) {
+		auto animation = animationRow.second;
+		ASSERT(animation != NULL, "animation can't be null");
+		animation->loadState(stateBuffer);
+	}
+}
+
+void AnimationController::shutdown() {
+	//DEBUG("Shutting down AnimationController");
 	for (auto animationRow : mAnimationMap) {
 		auto animation = animationRow.second;
 		ASSERT(
 			animation != NULL,
-			"AnimationController::draw, animation map can't be null"
+			"AnimationController::shutdown, animation map can't be null"
 		);
-		if (animation->isEnabled()) {
-			animation->draw();
-		} else {
-			//Nothing to do
-		}
+		animation->shutdown();
 	}
 }
 
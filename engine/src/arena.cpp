@@ -0,0 +1,128 @@
+/**
+ * @file arena.cpp
+ * @brief Purpose: Contains the methods of the Arena class.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "arena.hpp"
+
+using namespace engine;
+
+/**
+ * @brief Constructor for the Arena.
+ *
+ * No memory is taken until the first object is created.
+ *
+ * @param chunkSize size of each chunk of memory (bytes).
+ *
+ * @return "void".
+*/
+Arena::Arena(std::size_t chunkSize) {
+	ASSERT(chunkSize > 0, "The chunk size must be positive.");
+	mChunkSize = chunkSize;
+	mCurrentChunk = 0;
+	mChunkPosition = 0;
+	mDestructorList = NULL;
+	mObjectCount = 0;
+}
+
+/**
+ * @brief Destructor for the Arena.
+ *
+ * Destroys the objects left and frees every chunk.
+ *
+ * @return "void".
+*/
+Arena::~Arena() {
+	reset();
+
+	for (auto eachChunk : mChunkList) {
+		delete[] eachChunk.memory;
+	}
+}
+
+/**
+ * @brief take memory from the arena.
+ *
+ * Moves to the next chunk, or takes a new one, when the current chunk is
+ * full. The memory is given back by "reset" only.
+ *
+ * @param size bytes needed.
+ * @param alignment alignment of the memory, a power of two.
+ *
+ * @return the memory.
+*/
+void *Arena::allocate(std::size_t size, std::size_t alignment) {
+	ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0, "The alignment must be a power of two.");
+
+	while (true) {
+		if (mCurrentChunk < mChunkList.size()) {
+			Chunk &chunk = mChunkList[mCurrentChunk];
+			std::size_t address = reinterpret_cast<std::size_t>(chunk.memory) + mChunkPosition;
+			std::size_t padding = (alignment - address % alignment) % alignment;
+
+			if (mChunkPosition + padding + size <= chunk.size) {
+				void *memory = chunk.memory + mChunkPosition + padding;
+				mChunkPosition += padding + size;
+				return memory;
+			} else {
+				// The chunk is full, what is left of it stays unused until "reset".
+				mCurrentChunk++;
+				mChunkPosition = 0;
+			}
+		} else {
+			Chunk chunk;
+			chunk.size = size + alignment > mChunkSize ? size + alignment : mChunkSize;
+			chunk.memory = new unsigned char[chunk.size];
+			mChunkList.push_back(chunk);
+		}
+	}
+}
+
+/**
+ * @brief destroy every object of the arena.
+ *
+ * Objects are destroyed newest first, as they would be if each one owned
+ * the ones created after it. The chunks are kept for the next objects.
+ *
+ * @return "void".
+*/
+void Arena::reset() {
+	while (mDestructorList != NULL) {
+		Destructor *destructor = mDestructorList;
+		mDestructorList = destructor->next;
+		destructor->destroy(destructor->object);
+	}
+
+	mCurrentChunk = 0;
+	mChunkPosition = 0;
+	mObjectCount = 0;
+}
+
+/**
+ * @brief count the objects on the arena.
+ *
+ * @return number of objects created since the last reset.
+*/
+unsigned int Arena::getObjectCount() {
+	return mObjectCount;
+}
+
+/**
+ * @brief measure the memory taken from the arena.
+ *
+ * @return bytes taken since the last reset, counting the unused ends of
+ * full chunks.
+*/
+std::size_t Arena::getUsedSize() {
+	std::size_t usedSize = 0;
+
+	for (unsigned int index = 0; index < mCurrentChunk && index < mChunkList.size(); index++) {
+		usedSize += mChunkList[index].size;
+	}
+
+	return usedSize + mChunkPosition;
+}
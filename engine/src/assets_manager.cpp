@@ -10,6 +10,8 @@
 #include <fstream>
 #include "assets_manager.hpp"
 #include "game.hpp"
+#include "profiler.hpp"
+#include "timer.hpp"
 
 using namespace engine;// Used to avoid write engine::Game engine::Game::instance;.
 
@@ -18,11 +20,14 @@ using namespace engine;// Used to avoid write engine::Game engine::Game::instanc
 *
 * @return "void".
 */
-	AssetsManager::AssetsManager() {}
+	AssetsManager::AssetsManager() {
+		preloadRunning = false;
+	}
 
 
 	// Load image into image map.
 	Image* AssetsManager::LoadImage(std::string imagePath) {
+		PROFILE_SCOPE("AssetsManager::LoadImage");
 		ASSERT(imagePath != "", "Animation::CreateAnimation, imagePath is empty.");
 		//DEBUG("Image Map size before loading " << imageMap.size());
 
@@ -94,6 +99,7 @@ using namespace engine;// Used to avoid write engine::Game engine::Game::instanc
 
 	// Load music into music map.
 	Mix_Music* AssetsManager::LoadMusic(std::string audioPath) {
+		PROFILE_SCOPE("AssetsManager::LoadMusic");
 		DEBUG("Trying to load music " << audioPath);
 		DEBUG("Music Map size before loading " << musicMap.size());
 
@@ -138,6 +144,7 @@ using namespace engine;// Used to avoid write engine::Game engine::Game::instanc
 
 	// Load sound into sound map.
 	Mix_Chunk* AssetsManager::LoadSound(std::string audioPath) {
+		PROFILE_SCOPE("AssetsManager::LoadSound");
 		DEBUG("Trying to load Sound " << audioPath);
 		DEBUG("Sound Map size before loading " << soundMap.size());
 
@@ -179,6 +186,305 @@ using namespace engine;// Used to avoid write engine::Game engine::Game::instanc
 		DEBUG("Sound Map size after inserting " << soundMap.size());
 	}
 
+	/**
+	 * @brief start decoding the assets of a list on the preload thread.
+	 *
+	 * Images are decoded into surfaces, and musics and sounds are fully
+	 * loaded, away from the main thread. The images only become textures
+	 * when "uploadPreloaded" is called. Assets already loaded or already
+	 * being preloaded are skipped.
+	 *
+	 * @param assetList assets to preload, usually collected from a scene.
+	 *
+	 * @return "void".
+	*/
+	void AssetsManager::preload(const AssetList &assetList) {
+		PROFILE_SCOPE("AssetsManager::preload");
+		std::unique_lock<std::mutex> lock(preloadMutex);
+
+		queuePreload(AssetType::IMAGE, assetList.imagePaths);
+		queuePreload(AssetType::MUSIC, assetList.musicPaths);
+		queuePreload(AssetType::SOUND, assetList.soundPaths);
+
+		if (preloadQueue.empty() == false && preloadRunning == false) {
+			preloadRunning = true;
+			lock.unlock();
+
+			// The last thread already left its loop, it only needs to be joined.
+			if (preloadThread.joinable()) {
+				preloadThread.join();
+			} else {
+				//Nothing to do. There was no thread before.
+			}
+
+			preloadThread = std::thread(&AssetsManager::preloadLoop, this);
+		} else {
+			//Nothing to do. The thread is running or there's nothing to load.
+		}
+	}
+
+	/**
+	 * @brief add the paths not loaded yet to the preload queue.
+	 *
+	 * Must be called with preloadMutex locked.
+	 *
+	 * @param type kind of asset of every path.
+	 * @param paths paths of the assets.
+	 *
+	 * @return "void".
+	*/
+	void AssetsManager::queuePreload(AssetType type, const std::vector<std::string> &paths) {
+		for (auto &path : paths) {
+			bool loaded = false;
+
+			switch (type) {
+				case AssetType::IMAGE:
+					loaded = imageMap.find(path) != imageMap.end();
+					break;
+				case AssetType::MUSIC:
+					loaded = musicMap.find(path) != musicMap.end();
+					break;
+				case AssetType::SOUND:
+					loaded = soundMap.find(path) != soundMap.end();
+					break;
+			}
+
+			if (path != "" && loaded == false && pendingPaths.find(path) == pendingPaths.end()) {
+				PreloadedAsset asset = {type, path, NULL, NULL, NULL};
+
+				pendingPaths.insert(path);
+				preloadQueue.push_back(asset);
+			} else {
+				//Nothing to do. The asset is loaded or on its way.
+			}
+		}
+	}
+
+	/**
+	 * @brief decode the queued assets until the queue is empty.
+	 *
+	 * Runs on the preload thread.
+	 *
+	 * @return "void".
+	*/
+	void AssetsManager::preloadLoop() {
+		std::unique_lock<std::mutex> lock(preloadMutex);
+
+		while (preloadQueue.empty() == false) {
+			PreloadedAsset asset = preloadQueue.front();
+			preloadQueue.pop_front();
+			lock.unlock();
+
+			decodeAsset(asset);
+
+			lock.lock();
+			decodedQueue.push_back(asset);
+		}
+
+		preloadRunning = false;
+	}
+
+	/**
+	 * @brief decode an asset from its file.
+	 *
+	 * Doesn't touch the maps, so it may run on any thread.
+	 *
+	 * @param asset asset to decode.
+	 *
+	 * @return "void".
+	*/
+	void AssetsManager::decodeAsset(PreloadedAsset &asset) {
+		PROFILE_SCOPE("AssetsManager::decode");
+
+		switch (asset.type) {
+			case AssetType::IMAGE:
+				asset.surface = IMG_Load(asset.path.c_str());
+				break;
+			case AssetType::MUSIC:
+				asset.music = Mix_LoadMUS(asset.path.c_str());
+				break;
+			case AssetType::SOUND:
+				asset.sound = Mix_LoadWAV(asset.path.c_str());
+				break;
+		}
+	}
+
+	/**
+	 * @brief move the preloaded assets into the maps.
+	 *
+	 * Must be called on the main thread, since it creates the textures of
+	 * the decoded images. Stops once timeBudget is spent so a big scene is
+	 * uploaded over several frames, but always uploads at least one asset.
+	 *
+	 * @param timeBudget time it may spend uploading (miliseconds).
+	 *
+	 * @return true when every preloaded asset is in the maps.
+	*/
+	bool AssetsManager::uploadPreloaded(double timeBudget) {
+		PROFILE_SCOPE("AssetsManager::uploadPreloaded");
+		ASSERT(timeBudget > 0.0, "The upload time budget must be bigger than zero.");
+
+		double startTime = Timer::getMilliseconds();
+		std::unique_lock<std::mutex> lock(preloadMutex);
+
+		while (decodedQueue.empty() == false && Timer::getMilliseconds() - startTime < timeBudget) {
+			PreloadedAsset asset = decodedQueue.front();
+			decodedQueue.pop_front();
+			lock.unlock();
+
+			uploadAsset(asset);
+			pendingPaths.erase(asset.path);
+
+			lock.lock();
+		}
+
+		bool resident = pendingPaths.empty();
+		bool running = preloadRunning;
+		lock.unlock();
+
+		if (resident && running == false && preloadThread.joinable()) {
+			preloadThread.join();
+		} else {
+			//Nothing to do. The thread is still decoding or was already joined.
+		}
+
+		return resident;
+	}
+
+	/**
+	 * @brief load every preloaded asset right now.
+	 *
+	 * The main thread decodes what the preload thread didn't start yet, so
+	 * the wait doesn't depend on when the thread gets to run.
+	 *
+	 * @return "void".
+	*/
+	void AssetsManager::finishPreloading() {
+		PROFILE_SCOPE("AssetsManager::finishPreloading");
+		std::unique_lock<std::mutex> lock(preloadMutex);
+
+		while (preloadQueue.empty() == false) {
+			PreloadedAsset asset = preloadQueue.front();
+			preloadQueue.pop_front();
+			lock.unlock();
+
+			decodeAsset(asset);
+
+			lock.lock();
+			decodedQueue.push_back(asset);
+		}
+
+		lock.unlock();
+
+		// The thread leaves its loop after the asset it may still be decoding.
+		if (preloadThread.joinable()) {
+			preloadThread.join();
+		} else {
+			//Nothing to do. There's no thread to wait.
+		}
+
+		for (auto &asset : decodedQueue) {
+			uploadAsset(asset);
+			pendingPaths.erase(asset.path);
+		}
+
+		decodedQueue.clear();
+		ASSERT(pendingPaths.empty(), "Every preloaded asset must be loaded.");
+	}
+
+	/**
+	 * @brief insert a decoded asset into its map.
+	 *
+	 * Assets loaded synchronously in the meantime are kept, and the preloaded
+	 * copy is freed.
+	 *
+	 * @param asset asset decoded by the preload thread.
+	 *
+	 * @return "void".
+	*/
+	void AssetsManager::uploadAsset(PreloadedAsset &asset) {
+		switch (asset.type) {
+			case AssetType::IMAGE:
+				if (asset.surface == NULL) {
+					errorLog(ErrorType::NULL_POINTER, "AssetsManager::uploadAsset");
+					ERROR("Couldn't preload image " << asset.path);
+				} else if (imageMap.find(asset.path) == imageMap.end()) {
+					SDL_Texture *imageTexture = SDL_CreateTextureFromSurface(Game::instance.sdlElements.getCanvas(), asset.surface);
+
+					if (imageTexture != NULL) {
+						InsertIntoImageMap(asset.path, asset.surface, imageTexture);
+					} else {
+						errorLog(ErrorType::NULL_POINTER, "AssetsManager::uploadAsset");
+						ERROR("Couldn't create texture from image: " << SDL_GetError());
+					}
+				} else {
+					//Nothing to do. The image was loaded in the meantime.
+				}
+
+				if (asset.surface != NULL) {
+					SDL_FreeSurface(asset.surface);
+				} else {
+					//Nothing to do. There's no surface to free.
+				}
+				break;
+			case AssetType::MUSIC:
+				if (asset.music == NULL) {
+					errorLog(ErrorType::NULL_POINTER, "AssetsManager::uploadAsset");
+					ERROR("Could not preload music from path " << asset.path);
+				} else if (musicMap.find(asset.path) == musicMap.end()) {
+					InsertIntoMusicMap(asset.path, asset.music);
+				} else {
+					Mix_FreeMusic(asset.music);
+				}
+				break;
+			case AssetType::SOUND:
+				if (asset.sound == NULL) {
+					errorLog(ErrorType::NULL_POINTER, "AssetsManager::uploadAsset");
+					ERROR("Could not preload sound from path " << asset.path);
+				} else if (soundMap.find(asset.path) == soundMap.end()) {
+					InsertIntoSoundMap(asset.path, asset.sound);
+				} else {
+					Mix_FreeChunk(asset.sound);
+				}
+				break;
+		}
+	}
+
+	/**
+	 * @brief stop the preload thread and drop what it didn't upload.
+	 *
+	 * Must be called before SDL is terminated.
+	 *
+	 * @return "void".
+	*/
+	void AssetsManager::stopPreloading() {
+		{
+			std::lock_guard<std::mutex> lock(preloadMutex);
+			preloadQueue.clear();
+		}
+
+		if (preloadThread.joinable()) {
+			preloadThread.join();
+		} else {
+			//Nothing to do. There's no thread to stop.
+		}
+
+		for (auto &asset : decodedQueue) {
+			if (asset.surface != NULL) {
+				SDL_FreeSurface(asset.surface);
+			} else if (asset.music != NULL) {
+				Mix_FreeMusic(asset.music);
+			} else if (asset.sound != NULL) {
+				Mix_FreeChunk(asset.sound);
+			} else {
+				//Nothing to do. The asset failed to load.
+			}
+		}
+
+		decodedQueue.clear();
+		pendingPaths.clear();
+	}
+
 	/*
 	*@brief Method to log error messages.
 	*
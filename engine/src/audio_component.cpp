@@ -9,6 +9,8 @@
   */
 #include "audio_component.hpp"
 #include "game.hpp"
+#include "assets_manager.hpp"
+#include "state_buffer.hpp"
 #include <ctime>
 #include <fstream>
 #include <iostream>
@@ -75,10 +77,59 @@ void AudioComponent::init() {
 		}
 	}
 
+	Game::instance.getComponentSystems().mAudioPool.add(*this);
 }
 
+/*
+ *@brief Method to list the audio loaded on init.
+ *
+ *@return "void"
+ */
+void AudioComponent::collectAssets(AssetList &assetList) {
+	if (audioPath == "") {
+		//Nothing to do. There's no audio to load.
+	} else if (isMusic) {
+		assetList.musicPaths.push_back(audioPath);
+	} else {
+		assetList.soundPaths.push_back(audioPath);
+	}
+}
+
+
+/*
+ *@brief Method to write the audio state.
+ *
+ *@return "void"
+ */
+void AudioComponent::saveState(StateBuffer &stateBuffer) {
+	Component::saveState(stateBuffer);
+	stateBuffer.write(audioState);
+	stateBuffer.write(playOnStart);
+}
 
-void AudioComponent::updateCode() {
+/*
+ *@brief Method to read back the audio state.
+ *
+ * The audio itself isn't played or stopped: audios playing on start play
+ * again on the next update.
+ *
+ *@return "void"
+ */
+void AudioComponent::loadState(StateBuffer &stateBuffer) {
+	Component::loadState(stateBuffer);
+	stateBuffer.read(audioState);
+	stateBuffer.read(playOnStart);
+}
+
+
+/*
+ *@brief Method to start the audio played on startup
+ *
+ *Called by the audio system on each update.
+ *
+ *@return "void"
+ */
+void AudioComponent::updateAudio() {
 
 	if (playOnStart) {
 		DEBUG("Playing audio on startup");
@@ -97,6 +148,7 @@ void AudioComponent::updateCode() {
 void AudioComponent::shutdown() {
 
 	DEBUG("Shutdown audio component");
+	Game::instance.getComponentSystems().mAudioPool.remove(*this);
 
 	stop(-1);
 
@@ -8,6 +8,7 @@
  * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
  */
 #include "audio_controller.hpp"
+#include "state_buffer.hpp"
 #include <ctime>
 #include <fstream>
 #include <iostream>
@@ -53,19 +54,41 @@ void AudioController::init() {
 }
 
 
-void AudioController::updateCode() {
+/*
+ *@brief Method to list the audios loaded on init.
+ *
+ * Collects the assets of every audio in the audio map.
+ */
+void AudioController::collectAssets(AssetList &assetList) {
 	for(auto audioRow : audioMap) {
 		auto audio = audioRow.second;
+		audio->collectAssets(assetList);
+	}
+}
 
-		if(audio->isEnabled()) {
-			audio->updateCode();
-		} else {
-			DEBUG("Audio" << audio->audioPath << "is disabled");
-			// Nothing to do.
-		}
+/*
+ *@brief Method to write the state of every audio.
+ */
+void AudioController::saveState(StateBuffer &stateBuffer) {
+	Component::saveState(stateBuffer);
+
+	for(auto audioRow : audioMap) {
+		auto audio = audioRow.second;
+		audio->saveState(stateBuffer);
 	}
 }
 
+/*
+ *@brief Method to read back the state of every audio.
+ */
+void AudioController::loadState(StateBuffer &stateBuffer) {
+	Component::loadState(stateBuffer);
+
+	for(auto audioRow : audioMap) {
+		auto audio = audioRow.second;
+		audio->loadState(stateBuffer);
+	}
+}
 
 /*
  *@brief Method to add audio
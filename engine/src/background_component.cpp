@@ -48,20 +48,31 @@ void BackgroundComponent::init(){
 	componentHeight = assetsImage->height;
 
 	renderQuad = {COMPONENT_X, COMPONENT_Y, componentWidth, componentHeight};
+	Game::instance.getComponentSystems().mBackgroundPool.add(*this);
+}
+
+void BackgroundComponent::collectAssets(AssetList &assetList){
+	if(imagePath != ""){
+		assetList.imagePaths.push_back(imagePath);
+	} else {
+		//Nothing to do. There's no image to load.
+	}
 }
 
 void BackgroundComponent::shutdown(){
 	DEBUG("Calling BackgroundComponent::shutdown");
+	Game::instance.getComponentSystems().mBackgroundPool.remove(*this);
 	// Terminate Texture
 	imageTexture = NULL;
 }
 
 void BackgroundComponent::draw(){
 	//DEBUG("Calling BackgroundComponent::draw");
-	SDL_RenderCopy(
-		Game::instance.sdlElements.getCanvas(),
+	Game::instance.getRenderQueue().push(
 		imageTexture,
-		&renderQuad,
-		NULL
+		renderQuad,
+		NULL,
+		gameObject->mLayer,
+		gameObject->mDrawOrder
 	);
 }
@@ -0,0 +1,112 @@
+/**
+ * @file camera.cpp
+ * @brief Purpose: Contains the methods of the Camera class.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "camera.hpp"
+#include "state_buffer.hpp"
+
+using namespace engine;
+
+/**
+ * @brief Default constructor for the Camera.
+ *
+ * @return "void".
+*/
+Camera::Camera() {
+	reset();
+}
+
+/**
+ * @brief put the camera back on the origin of the world.
+ *
+ * Called before a scene is initialized, so it starts where the last one
+ * left it.
+ *
+ * @return "void".
+*/
+void Camera::reset() {
+	mPosition = std::make_pair(0.0, 0.0);
+	mPreviousPosition = mPosition;
+	mViewPosition = mPosition;
+}
+
+/**
+ * @brief place the camera on the world.
+ *
+ * It isn't drawn moving there, the last step is placed there too.
+ *
+ * @param position left upper corner of the screen on the world.
+ *
+ * @return "void".
+*/
+void Camera::setPosition(std::pair<double, double> position) {
+	mPosition = position;
+	mPreviousPosition = position;
+}
+
+/**
+ * @brief move the camera along the world.
+ *
+ * @param moveX distance to the right (pixels).
+ * @param moveY distance down (pixels).
+ *
+ * @return "void".
+*/
+void Camera::move(double moveX, double moveY) {
+	mPosition.first += moveX;
+	mPosition.second += moveY;
+}
+
+/**
+ * @brief keep the position of the last simulation step.
+ *
+ * @return "void".
+*/
+void Camera::storePreviousPosition() {
+	mPreviousPosition = mPosition;
+}
+
+/**
+ * @brief find the position the frame is drawn from.
+ *
+ * Called once before each frame is recorded, so the draws only read it.
+ *
+ * @param interpolationFactor 0.0 for the previous position, 1.0 for the current one.
+ *
+ * @return "void".
+*/
+void Camera::updateView(double interpolationFactor) {
+	mViewPosition.first = mPreviousPosition.first
+		+ (mPosition.first - mPreviousPosition.first) * interpolationFactor;
+	mViewPosition.second = mPreviousPosition.second
+		+ (mPosition.second - mPreviousPosition.second) * interpolationFactor;
+}
+
+/**
+ * @brief write the position of the camera.
+ *
+ * @param stateBuffer buffer that receives the state.
+ *
+ * @return "void".
+*/
+void Camera::saveState(StateBuffer &stateBuffer) {
+	stateBuffer.write(mPosition);
+	stateBuffer.write(mPreviousPosition);
+}
+
+/**
+ * @brief read back the state written by "saveState".
+ *
+ * @param stateBuffer buffer that holds the state.
+ *
+ * @return "void".
+*/
+void Camera::loadState(StateBuffer &stateBuffer) {
+	stateBuffer.read(mPosition);
+	stateBuffer.read(mPreviousPosition);
+}
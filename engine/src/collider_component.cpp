@@ -0,0 +1,121 @@
+/**
+ * @file collider_component.cpp
+ * @brief Purpose: Contains the methods of the ColliderComponent class.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "collider_component.hpp"
+#include "game.hpp"
+#include "log.h"
+
+using namespace engine;
+
+/**
+ * @brief Constructor for a collider with the measures of its game object.
+ *
+ * @param gameObject game object the collider belongs to.
+ * @param colliderType whether the collider moves.
+ *
+ * @return "void".
+*/
+ColliderComponent::ColliderComponent(GameObject &gameObject, ColliderType colliderType) :
+	Component(gameObject), mContactManifold(0.0, 0.0) {
+	this->gameObject = &gameObject;
+	mColliderType = colliderType;
+	mFitsGameObject = true;
+	mOffset = std::make_pair(0.0, 0.0);
+	mSize = std::make_pair(0.0, 0.0);
+}
+
+/**
+ * @brief Constructor for a collider with a box of its own.
+ *
+ * @param gameObject game object the collider belongs to.
+ * @param colliderType whether the collider moves.
+ * @param offset from the game object position to the box (pixels).
+ * @param size of the box (pixels).
+ *
+ * @return "void".
+*/
+ColliderComponent::ColliderComponent(GameObject &gameObject, ColliderType colliderType,
+                                     std::pair<double, double> offset, std::pair<double, double> size) :
+	Component(gameObject), mContactManifold(0.0, 0.0) {
+	ASSERT(size.first >= 0.0 && size.second >= 0.0, "The size can't be negative.");
+	this->gameObject = &gameObject;
+	mColliderType = colliderType;
+	mFitsGameObject = false;
+	mOffset = offset;
+	mSize = size;
+}
+
+/**
+ * @brief put the collider on the physics world.
+ *
+ * @return "void".
+*/
+void ColliderComponent::init() {
+	Game::instance.getPhysicsWorld().addCollider(*this);
+}
+
+/**
+ * @brief take the collider out of the physics world.
+ *
+ * @return "void".
+*/
+void ColliderComponent::shutdown() {
+	Game::instance.getPhysicsWorld().removeCollider(*this);
+}
+
+/**
+ * @brief read back the state written by "saveState".
+ *
+ * The game object may have jumped anywhere, so the next step doesn't sweep
+ * from the last box, and every contact starts over.
+ *
+ * @param stateBuffer buffer that holds the state.
+ *
+ * @return "void".
+*/
+void ColliderComponent::loadState(StateBuffer &stateBuffer) {
+	Component::loadState(stateBuffer);
+	mHasLastBox = false;
+	mTouchingList.clear();
+	mContactManifold.clear();
+}
+
+/**
+ * @brief calculate the box of the collider.
+ *
+ * @return the box, in the coordinates of the game object.
+*/
+CollisionBox ColliderComponent::calcBox() {
+	CollisionBox box;
+
+	if (mFitsGameObject) {
+		std::pair<double, double> bottomLeft = gameObject->calcBottomLeft();
+		std::pair<double, double> topRight = gameObject->calcTopRight();
+		box = {bottomLeft.first, topRight.second, topRight.first, bottomLeft.second};
+	} else {
+		const std::pair<double, double> &position = gameObject->getWorldPosition();
+		double left = position.first + mOffset.first;
+		double top = position.second + mOffset.second;
+		box = {left, top, left + mSize.first, top + mSize.second};
+	}
+
+	return box;
+}
+
+/**
+ * @brief set how walls are found for this collider.
+ *
+ * @param wallInsetX how far right walls reach towards the collider.
+ * @param wallInsetY how much lower than the top right walls start.
+ *
+ * @return "void".
+*/
+void ColliderComponent::setWallInset(double wallInsetX, double wallInsetY) {
+	mContactManifold = ContactManifold(wallInsetX, wallInsetY);
+}
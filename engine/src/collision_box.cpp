@@ -0,0 +1,83 @@
+/**
+ * @file collision_box.cpp
+ * @brief Purpose: Contains the methods of the CollisionBox struct.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "collision_box.hpp"
+#include <algorithm>
+#include <limits>
+
+using namespace engine;
+
+/**
+ * @brief find when the box touches the target while moving.
+ *
+ * Each axis gives the interval of the movement in which the boxes overlap
+ * on it, and the boxes touch where those intervals meet. Since the whole
+ * path is tested, a long movement can't skip a thin target. Boxes that
+ * already overlap at the start aren't reported.
+ *
+ * @param moveX how far the box moves on x.
+ * @param moveY how far the box moves on y.
+ * @param target box that stays still.
+ * @param hit filled with the time and side of the touch.
+ *
+ * @return true when the box touches the target during the movement.
+*/
+bool CollisionBox::sweep(double moveX, double moveY, const CollisionBox &target, SweepHit &hit) const {
+	const double INFINITE = std::numeric_limits<double>::infinity();
+
+	double entryX = -INFINITE;
+	double exitX = INFINITE;
+	double entryY = -INFINITE;
+	double exitY = INFINITE;
+
+	if (moveX > 0.0) {
+		entryX = (target.left - right) / moveX;
+		exitX = (target.right - left) / moveX;
+	} else if (moveX < 0.0) {
+		entryX = (target.right - left) / moveX;
+		exitX = (target.left - right) / moveX;
+	} else if (right < target.left || left > target.right) {
+		return false;
+	} else {
+		//Nothing to do. Always overlapping on x.
+	}
+
+	if (moveY > 0.0) {
+		entryY = (target.top - bottom) / moveY;
+		exitY = (target.bottom - top) / moveY;
+	} else if (moveY < 0.0) {
+		entryY = (target.bottom - top) / moveY;
+		exitY = (target.top - bottom) / moveY;
+	} else if (bottom < target.top || top > target.bottom) {
+		return false;
+	} else {
+		//Nothing to do. Always overlapping on y.
+	}
+
+	double entry = std::max(entryX, entryY);
+	double exit = std::min(exitX, exitY);
+
+	if (entry > exit || entry < 0.0 || entry > 1.0) {
+		return false;
+	} else {
+		//Nothing to do. The boxes touch during the movement.
+	}
+
+	hit.time = entry;
+	hit.normalX = 0;
+	hit.normalY = 0;
+
+	if (entryX > entryY) {
+		hit.normalX = moveX > 0.0 ? -1 : 1;
+	} else {
+		hit.normalY = moveY > 0.0 ? -1 : 1;
+	}
+
+	return true;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file collision_grid.cpp
+ * @brief Purpose: Contains the methods of the CollisionGrid class.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "collision_grid.hpp"
+#include <algorithm>
+#include <limits>
+
+using namespace engine;
+
+const unsigned int NO_CELL = std::numeric_limits<unsigned int>::max(); // Nothing inserted since the last clear.
+
+/**
+ * @brief Constructor for the CollisionGrid.
+ *
+ * @param cellWidth width of each cell, in pixels.
+ *
+ * @return "void".
+*/
+CollisionGrid::CollisionGrid(double cellWidth) {
+	ASSERT(cellWidth > 0.0, "The cell width must be positive.");
+	mCellWidth = cellWidth;
+	mFirstCell = 0;
+	mLowestCell = NO_CELL;
+}
+
+/**
+ * @brief drop every interval.
+ *
+ * The cells keep their memory, so a grid can be refilled on every frame
+ * without allocating. The next fill starts on the lowest cell of this one,
+ * so the cells the objects left behind are reused ahead of them.
+ *
+ * @return "void".
+*/
+void CollisionGrid::clear() {
+	for (auto &eachCell : mCellList) {
+		eachCell.clear();
+	}
+
+	if (mLowestCell != NO_CELL) {
+		mFirstCell = mLowestCell;
+		mLowestCell = NO_CELL;
+	} else {
+		//Nothing to do. The grid was empty, it stays where it was.
+	}
+}
+
+/**
+ * @brief add an interval to the cells it touches.
+ *
+ * @param id value returned by the queries that reach the interval.
+ * @param left lowest x of the interval.
+ * @param right highest x of the interval.
+ *
+ * @return "void".
+*/
+void CollisionGrid::insert(unsigned int id, double left, double right) {
+	ASSERT(left <= right, "The interval can't end before it starts.");
+
+	mLowestCell = std::min(mLowestCell, findAxisCell(left));
+	unsigned int lastCell = findCell(right);
+
+	if (lastCell >= mCellList.size()) {
+		mCellList.resize(lastCell + 1);
+	} else {
+		//Nothing to do.
+	}
+
+	for (unsigned int cell = findCell(left); cell <= lastCell; cell++) {
+		mCellList[cell].push_back(id);
+	}
+}
+
+/**
+ * @brief find the intervals that may overlap an x range.
+ *
+ * Every interval overlapping the range is found, along with some that only
+ * share a cell with it. The ids come sorted and without repetition, so they
+ * can be walked in insertion order when ids are given in increasing order.
+ *
+ * @param left lowest x of the range.
+ * @param right highest x of the range.
+ * @param candidates cleared and filled with the ids found.
+ *
+ * @return "void".
+*/
+void CollisionGrid::query(double left, double right, std::vector<unsigned int> &candidates) {
+	candidates.clear();
+
+	if (!mCellList.empty()) {
+		unsigned int lastCell = std::min(findCell(right), (unsigned int) mCellList.size() - 1);
+
+		for (unsigned int cell = std::min(findCell(left), lastCell); cell <= lastCell; cell++) {
+			candidates.insert(candidates.end(), mCellList[cell].begin(), mCellList[cell].end());
+		}
+
+		std::sort(candidates.begin(), candidates.end());
+		candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+	} else {
+		//Nothing to do.
+	}
+}
+
+/**
+ * @brief cell under a x coordinate.
+ *
+ * @param x coordinate to look for.
+ *
+ * @return index of the cell on mCellList, 0 for coordinates before the grid.
+*/
+unsigned int CollisionGrid::findCell(double x) {
+	unsigned int cell = findAxisCell(x);
+
+	if (cell > mFirstCell) {
+		return cell - mFirstCell;
+	} else {
+		return 0;
+	}
+}
+
+/**
+ * @brief cell of the x axis under a x coordinate.
+ *
+ * @param x coordinate to look for.
+ *
+ * @return index of the cell counted from x = 0, 0 for negative coordinates.
+*/
+unsigned int CollisionGrid::findAxisCell(double x) {
+	unsigned int cell = 0;
+
+	if (x > 0.0) {
+		cell = (unsigned int) (x / mCellWidth);
+	} else {
+		//Nothing to do.
+	}
+
+	return cell;
+}
@@ -0,0 +1,166 @@
+/**
+ * @file collision_world.cpp
+ * @brief Purpose: Contains the methods of the CollisionWorld class.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "collision_world.hpp"
+#include <cfloat>
+#include <cmath>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace engine;
+
+/**
+ * @brief Default constructor for the CollisionWorld.
+ *
+ * @return "void".
+*/
+CollisionWorld::CollisionWorld() {
+	clear();
+}
+
+/**
+ * @brief drop every box.
+ *
+ * @return "void".
+*/
+void CollisionWorld::clear() {
+	mBoxList.clear();
+	mMinXList.clear();
+	mMinYList.clear();
+	mMaxXList.clear();
+	mMaxYList.clear();
+	padColumns();
+}
+
+/**
+ * @brief add a static box.
+ *
+ * @param box box to add.
+ *
+ * @return id of the box, the number of boxes added before it.
+*/
+unsigned int CollisionWorld::addBox(const CollisionBox &box) {
+	ASSERT(box.left <= box.right && box.top <= box.bottom, "The box can't be inverted.");
+
+	unsigned int id = mBoxList.size();
+	mBoxList.push_back(box);
+
+	// Rounding outwards, so the float box holds the exact one.
+	mMinXList[id] = std::nextafter((float) box.left, -FLT_MAX);
+	mMinYList[id] = std::nextafter((float) box.top, -FLT_MAX);
+	mMaxXList[id] = std::nextafter((float) box.right, FLT_MAX);
+	mMaxYList[id] = std::nextafter((float) box.bottom, FLT_MAX);
+	padColumns();
+
+	return id;
+}
+
+/**
+ * @brief find the boxes that may overlap a box.
+ *
+ * Boxes touching only on an edge count as overlapping. Ids come in
+ * increasing order.
+ *
+ * @param box box to test.
+ * @param overlapList cleared and filled with the ids found.
+ *
+ * @return "void".
+*/
+void CollisionWorld::findOverlaps(const CollisionBox &box, std::vector<unsigned int> &overlapList) {
+	overlapList.clear();
+
+	const float left = std::nextafter((float) box.left, -FLT_MAX);
+	const float top = std::nextafter((float) box.top, -FLT_MAX);
+	const float right = std::nextafter((float) box.right, FLT_MAX);
+	const float bottom = std::nextafter((float) box.bottom, FLT_MAX);
+	const unsigned int paddedCount = mMinXList.size();
+
+#if defined(__AVX2__)
+	const __m256 queryLeft = _mm256_set1_ps(left);
+	const __m256 queryTop = _mm256_set1_ps(top);
+	const __m256 queryRight = _mm256_set1_ps(right);
+	const __m256 queryBottom = _mm256_set1_ps(bottom);
+
+	for (unsigned int first = 0; first < paddedCount; first += BATCH_SIZE) {
+		unsigned int mask = 0;
+
+		// Two registers of 8 boxes each.
+		for (unsigned int half = 0; half < 2; half++) {
+			unsigned int index = first + half * 8;
+			__m256 overlaps = _mm256_and_ps(
+				_mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&mMinXList[index]), queryRight, _CMP_LE_OQ),
+				              _mm256_cmp_ps(_mm256_loadu_ps(&mMaxXList[index]), queryLeft, _CMP_GE_OQ)),
+				_mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&mMinYList[index]), queryBottom, _CMP_LE_OQ),
+				              _mm256_cmp_ps(_mm256_loadu_ps(&mMaxYList[index]), queryTop, _CMP_GE_OQ)));
+			mask |= (unsigned int) _mm256_movemask_ps(overlaps) << (half * 8);
+		}
+
+		while (mask != 0) {
+			overlapList.push_back(first + __builtin_ctz(mask));
+			mask &= mask - 1;
+		}
+	}
+#elif defined(__SSE2__)
+	const __m128 queryLeft = _mm_set1_ps(left);
+	const __m128 queryTop = _mm_set1_ps(top);
+	const __m128 queryRight = _mm_set1_ps(right);
+	const __m128 queryBottom = _mm_set1_ps(bottom);
+	const unsigned int SSE_BATCH_SIZE = 8;
+
+	for (unsigned int first = 0; first < paddedCount; first += SSE_BATCH_SIZE) {
+		unsigned int mask = 0;
+
+		// Two registers of 4 boxes each.
+		for (unsigned int half = 0; half < 2; half++) {
+			unsigned int index = first + half * 4;
+			__m128 overlaps = _mm_and_ps(
+				_mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&mMinXList[index]), queryRight),
+				           _mm_cmpge_ps(_mm_loadu_ps(&mMaxXList[index]), queryLeft)),
+				_mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&mMinYList[index]), queryBottom),
+				           _mm_cmpge_ps(_mm_loadu_ps(&mMaxYList[index]), queryTop)));
+			mask |= (unsigned int) _mm_movemask_ps(overlaps) << (half * 4);
+		}
+
+		while (mask != 0) {
+			overlapList.push_back(first + __builtin_ctz(mask));
+			mask &= mask - 1;
+		}
+	}
+#else
+	for (unsigned int index = 0; index < paddedCount; index++) {
+		if (mMinXList[index] <= right && mMaxXList[index] >= left &&
+		    mMinYList[index] <= bottom && mMaxYList[index] >= top) {
+			overlapList.push_back(index);
+		} else {
+			//Nothing to do.
+		}
+	}
+#endif
+}
+
+/**
+ * @brief grow the columns to a whole number of batches.
+ *
+ * Slots past the last box hold inverted boxes, which fail every test, so
+ * the kernels never need a tail loop.
+ *
+ * @return "void".
+*/
+void CollisionWorld::padColumns() {
+	unsigned int paddedCount = (mBoxList.size() / BATCH_SIZE + 1) * BATCH_SIZE;
+
+	mMinXList.resize(paddedCount, FLT_MAX);
+	mMinYList.resize(paddedCount, FLT_MAX);
+	mMaxXList.resize(paddedCount, -FLT_MAX);
+	mMaxYList.resize(paddedCount, -FLT_MAX);
+}
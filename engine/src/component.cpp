@@ -11,10 +11,13 @@
  * This file is responsible for create the model to all components of the game.
 */
 #include "component.hpp"
+#include "state_buffer.hpp"
 #include "log.h"
 
 using namespace engine; // Used to avoid write engine::Game engine::Game::instance;.
 
+unsigned int ComponentType::sNextTypeId = 0;
+
 /**
  * @brief Default constructor for the component.
  *  
@@ -22,6 +25,8 @@ using namespace engine; // Used to avoid write engine::Game engine::Game::instan
 */
 Component::Component(){}
 
+Component::~Component(){}
+
 
 /**
  * @brief Constructor for the component.
@@ -67,6 +72,66 @@ void Component::shutdown(){}
 void Component::draw(){}
 
 
+/**
+ * @brief list the assets the component loads on its init.
+ *
+ * Lets a scene be preloaded before it starts. Components without assets
+ * add nothing.
+ *
+ * @param assetList list that receives the asset paths.
+ *
+ * @return "void".
+*/
+void Component::collectAssets(AssetList &assetList){
+	(void)assetList;
+}
+
+
+/**
+ * @brief write the mutable state of the component.
+ *
+ * Components with more state than enabled or disabled must extend it, and
+ * read everything back in the same order on "loadState".
+ *
+ * @param stateBuffer buffer that receives the state.
+ *
+ * @return "void".
+*/
+void Component::saveState(StateBuffer &stateBuffer){
+	stateBuffer.write(componentState);
+}
+
+
+/**
+ * @brief read back the state written by "saveState".
+ *
+ * @param stateBuffer buffer that holds the state.
+ *
+ * @return "void".
+*/
+void Component::loadState(StateBuffer &stateBuffer){
+	stateBuffer.read(componentState);
+}
+
+
+/**
+ * @brief react to a collider of the game object touching another one.
+ *
+ * Called by the physics world once its step is over, so the handler may
+ * add, remove or disable colliders. Components that react to collisions
+ * must extend it.
+ *
+ * @param event whether the colliders started, kept or stopped touching.
+ * @param other collider touched by the game object.
+ *
+ * @return "void".
+*/
+void Component::onCollision(CollisionEvent event, ColliderComponent &other){
+	(void)event;
+	(void)other;
+}
+
+
 /**
  * @brief inherits function that update the game code.  
  * 
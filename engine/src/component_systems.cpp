@@ -0,0 +1,105 @@
+/**
+ * @file component_systems.cpp
+ * @brief Purpose: Contains the methods of the ComponentSystems class.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "component_systems.hpp"
+#include "game_object.hpp"
+#include "profiler.hpp"
+
+using namespace engine;
+
+/**
+ * @brief drop every component of every pool.
+ *
+ * Called before a scene is initialized, so components of other scenes
+ * can't be left behind.
+ *
+ * @return "void".
+*/
+void ComponentSystems::clear() {
+	mBackgroundPool.clear();
+	mImagePool.clear();
+	mAnimationPool.clear();
+	mAudioPool.clear();
+}
+
+/**
+ * @brief advance the animations and start the audios.
+ *
+ * Runs after the code of every game object, so the game object measures
+ * come from the animation the code chose on this step.
+ *
+ * @return "void".
+*/
+void ComponentSystems::update() {
+	PROFILE_SCOPE("ComponentSystems::update");
+
+	for (auto animation : mAnimationPool) {
+		if (isActive(*animation)) {
+			animation->updateAnimation();
+		} else {
+			//Nothing to do. The animation isn't playing.
+		}
+	}
+
+	for (auto audio : mAudioPool) {
+		if (isActive(*audio)) {
+			audio->updateAudio();
+		} else {
+			//Nothing to do.
+		}
+	}
+}
+
+/**
+ * @brief record the draws of the backgrounds, images and animations.
+ *
+ * The render queue puts them back in the order of their game objects, and
+ * a game object with more than one type draws its backgrounds first, then
+ * its images and its animations.
+ *
+ * @return "void".
+*/
+void ComponentSystems::draw() {
+	PROFILE_SCOPE("ComponentSystems::draw");
+
+	for (auto background : mBackgroundPool) {
+		if (isActive(*background)) {
+			background->BackgroundComponent::draw();
+		} else {
+			//Nothing to do.
+		}
+	}
+
+	for (auto image : mImagePool) {
+		if (isActive(*image)) {
+			image->ImageComponent::draw();
+		} else {
+			//Nothing to do.
+		}
+	}
+
+	for (auto animation : mAnimationPool) {
+		if (isActive(*animation)) {
+			animation->Animation::draw();
+		} else {
+			//Nothing to do.
+		}
+	}
+}
+
+/**
+ * @brief check if a component runs on this frame.
+ *
+ * @param component component of a pool.
+ *
+ * @return true when the component and its game object are enabled.
+*/
+bool ComponentSystems::isActive(Component &component) {
+	return component.isEnabled() && component.getGameObject()->mObjectState == ObjectState::ENABLED;
+}
@@ -0,0 +1,216 @@
+/**
+ * @file contact_manifold.cpp
+ * @brief Purpose: Contains the methods of the ContactManifold class.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "contact_manifold.hpp"
+#include <algorithm>
+
+using namespace engine;
+
+/**
+ * @brief Constructor for the ContactManifold.
+ *
+ * @param wallInsetX how far right walls reach towards the body.
+ * @param wallInsetY how much lower than the top right walls start.
+ *
+ * @return "void".
+*/
+ContactManifold::ContactManifold(double wallInsetX, double wallInsetY) {
+	mWallInsetX = wallInsetX;
+	mWallInsetY = wallInsetY;
+	clear();
+}
+
+/**
+ * @brief forget every contact.
+ *
+ * @return "void".
+*/
+void ContactManifold::clear() {
+	setContact(ground, NULL, 0.0, 0.0);
+	setContact(ceiling, NULL, 0.0, 0.0);
+	setContact(leftWall, NULL, 0.0, 0.0);
+	setContact(rightWall, NULL, 0.0, 0.0);
+	triggerCount = 0;
+}
+
+/**
+ * @brief test the body against an object that blocks it.
+ *
+ * Ground is an object whose top is crossed by the body. Ceiling is an
+ * object whose bottom is crossed by the top of the body, while the body
+ * fits in its width. Walls are objects whose sides are crossed by the
+ * body, unless the body stands on them: landing lifts the body out of the
+ * object, so its side is never hit. Ground is the highest top crossed, the
+ * other sides keep the first contact found, so the order the solids are
+ * tested in only matters for walls and ceilings.
+ *
+ * @param body box of the moving body.
+ * @param solid box of the object.
+ * @param object game object the box belongs to.
+ *
+ * @return true when the body touches the solid on any side.
+*/
+bool ContactManifold::addSolid(const CollisionBox &body, const CollisionBox &solid, GameObject *object) {
+	ASSERT(object != NULL, "The object can't be null.");
+
+	bool isGround = body.left <= solid.right && body.right >= solid.left &&
+	                body.bottom > solid.top && body.top < solid.top;
+
+	bool touches = isGround;
+
+	if (isGround && (ground.object == NULL || solid.top < ground.surface)) {
+		setContact(ground, object, body.bottom - solid.top, solid.top);
+	} else {
+		//Nothing to do.
+	}
+
+	bool isCeiling = body.left >= solid.left && body.right <= solid.right &&
+	                 body.top <= solid.bottom && body.bottom >= solid.top && body.top >= solid.top;
+	touches = touches || isCeiling;
+
+	if (ceiling.object == NULL && isCeiling) {
+		setContact(ceiling, object, solid.bottom - body.top, solid.bottom);
+	} else {
+		//Nothing to do.
+	}
+
+	double wallLeft = solid.left - mWallInsetX;
+	double wallRight = solid.right + mWallInsetX;
+	double wallTop = solid.top + mWallInsetY;
+	double wallBottom = solid.bottom - mWallInsetY;
+
+	bool isRightWall = !isGround && body.left < wallLeft && body.left < wallRight &&
+	                   body.top <= wallBottom && body.bottom >= wallTop && body.right >= wallLeft;
+	touches = touches || isRightWall;
+
+	if (rightWall.object == NULL && isRightWall) {
+		setContact(rightWall, object, body.right - wallLeft, wallLeft);
+	} else {
+		//Nothing to do.
+	}
+
+	bool isLeftWall = !isGround && body.left <= solid.right && body.right > solid.right &&
+	                  body.top <= solid.bottom && body.bottom >= solid.top;
+	touches = touches || isLeftWall;
+
+	if (leftWall.object == NULL && isLeftWall) {
+		setContact(leftWall, object, solid.right - body.left, solid.right);
+	} else {
+		//Nothing to do.
+	}
+
+	return touches;
+}
+
+/**
+ * @brief test the body against a solid along its last movement.
+ *
+ * When the body was clear of the solid at the start, the whole movement is
+ * swept and the side hit first gives the contact, so a long frame can't
+ * carry the body through a thin solid. A side hit while the body crosses
+ * the top counts as ground, as in addSolid, and a bottom hit only counts as
+ * ceiling when the body fits in the solid width. Otherwise the end of the
+ * movement is tested as in addSolid.
+ *
+ * @param body box of the body at the end of the movement.
+ * @param moveX how far the body moved on x.
+ * @param moveY how far the body moved on y.
+ * @param solid box of the object.
+ * @param object game object the box belongs to.
+ *
+ * @return true when the body touches the solid, at the end or on the way.
+*/
+bool ContactManifold::addSweptSolid(const CollisionBox &body, double moveX, double moveY,
+                                    const CollisionBox &solid, GameObject *object) {
+	CollisionBox startBody = {body.left - moveX, body.top - moveY, body.right - moveX, body.bottom - moveY};
+	SweepHit hit;
+
+	if (!startBody.sweep(moveX, moveY, solid, hit)) {
+		return addSolid(body, solid, object);
+	} else {
+		//Nothing to do. The body entered the solid during the movement.
+	}
+
+	double hitTop = startBody.top + moveY * hit.time;
+	Contact *contact = NULL;
+	double depth = 0.0;
+	double surface = 0.0;
+
+	if (hit.normalY == -1 || (hit.normalX != 0 && hitTop < solid.top)) {
+		contact = &ground;
+		depth = body.bottom - solid.top;
+		surface = solid.top;
+	} else if (hit.normalY == 1) {
+		if (body.left >= solid.left && body.right <= solid.right) {
+			contact = &ceiling;
+			depth = solid.bottom - body.top;
+			surface = solid.bottom;
+		} else {
+			return addSolid(body, solid, object);
+		}
+	} else if (hit.normalX == -1) {
+		contact = &rightWall;
+		surface = solid.left - mWallInsetX;
+		depth = body.right - surface;
+	} else {
+		contact = &leftWall;
+		depth = solid.right - body.left;
+		surface = solid.right;
+	}
+
+	if (contact->object == NULL || (contact == &ground && surface < ground.surface)) {
+		setContact(*contact, object, depth, surface);
+	} else {
+		//Nothing to do. The side already has a contact.
+	}
+
+	return true;
+}
+
+/**
+ * @brief test the body against an object it can go through.
+ *
+ * Overlapping triggers are listed once each, with the smallest overlap
+ * between both axes as the depth. Triggers past MAX_TRIGGERS are dropped.
+ *
+ * @param body box of the moving body.
+ * @param trigger box of the object.
+ * @param object game object the box belongs to.
+ *
+ * @return true when the body overlaps the trigger, even if it was dropped.
+*/
+bool ContactManifold::addTrigger(const CollisionBox &body, const CollisionBox &trigger, GameObject *object) {
+	ASSERT(object != NULL, "The object can't be null.");
+
+	bool overlaps = body.left <= trigger.right && body.right >= trigger.left &&
+	                body.top <= trigger.bottom && body.bottom >= trigger.top;
+
+	if (overlaps && triggerCount < MAX_TRIGGERS) {
+		double overlapX = std::min(body.right, trigger.right) - std::max(body.left, trigger.left);
+		double overlapY = std::min(body.bottom, trigger.bottom) - std::max(body.top, trigger.top);
+
+		setContact(triggerList[triggerCount], object, std::min(overlapX, overlapY), 0.0);
+		triggerCount++;
+	} else {
+		//Nothing to do.
+	}
+
+	return overlaps;
+}
+
+/**
+ * @brief fill a contact.
+ *
+ * @return "void".
+*/
+void ContactManifold::setContact(Contact &contact, GameObject *object, double depth, double surface) {
+	contact.object = object;
+	contact.depth = depth;
+	contact.surface = surface;
+}
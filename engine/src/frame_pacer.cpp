@@ -0,0 +1,117 @@
+/**
+  * @file frame_pacer.cpp
+  * @brief Purpose: Contains all the methods related to the FramePacer class.
+  *
+  * GPL v3.0 License
+  * Copyright (c) 2017 Azo
+  *
+  * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+ */
+#include "frame_pacer.hpp"
+#include "timer.hpp"
+#include "log.h"
+
+using namespace engine;
+
+const Uint64 NANOSECONDS_PER_SECOND = 1000000000;
+const Uint64 NANOSECONDS_PER_MILLISECOND = 1000000;
+const Uint64 SPIN_TIME = 500000; // Last part of the wait done spinning (nanoseconds).
+const int DEFAULT_REFRESH_RATE = 60; // Refresh rate assumed when the display doesn't tell it (Hz).
+
+/*
+ *@brief Constructor for the frame pacer.
+ *
+ * Starts without pacing until a frame rate is set.
+ */
+FramePacer::FramePacer() {
+	framePeriod = 0;
+	deadline = 0;
+	vsyncPacing = false;
+}
+
+FramePacer::~FramePacer() {}
+
+/*
+ *@brief Method to set the frame rate to keep
+ *
+ *@param frameRate frames per second, zero disables the pacing.
+ */
+void FramePacer::setFrameRate(int frameRate) {
+	ASSERT(frameRate >= 0, "The frame rate can't be lower than zero.");
+
+	if(frameRate > 0) {
+		framePeriod = NANOSECONDS_PER_SECOND / frameRate;
+	} else {
+		framePeriod = 0;
+	}
+}
+
+/*
+ *@brief Method to tell the pacer about the renderer vsync
+ *
+ * When the renderer waits for the display and the display isn't faster than
+ * the frame rate, waiting again would lose a whole refresh. An unknown
+ * refresh rate (zero) is trusted to be a common 60 Hz display.
+ *
+ *@param vsync true when the renderer presents with vsync.
+ *@param refreshRate display refresh rate (Hz), zero when unknown.
+ *@param frameRate frames per second wanted by the game.
+ */
+void FramePacer::setVsync(bool vsync, int refreshRate, int frameRate) {
+	if(refreshRate == 0) {
+		refreshRate = DEFAULT_REFRESH_RATE;
+	} else {
+		//Nothing to do. The display told its refresh rate.
+	}
+
+	vsyncPacing = vsync && refreshRate <= frameRate;
+
+	if(vsyncPacing) {
+		INFO("Frames paced by vsync (" << refreshRate << " Hz).");
+	} else {
+		INFO("Frames paced by the frame pacer.");
+	}
+}
+
+/*
+ *@brief Method to start counting the first frame
+ */
+void FramePacer::start() {
+	deadline = Timer::getNanoseconds() + framePeriod;
+}
+
+/*
+ *@brief Method to wait until the end of the current frame
+ *
+ * Sleeps coarsely while the deadline is far, then spins until it. A frame
+ * late by more than a whole period starts a new schedule instead of
+ * rushing the next frames to catch up.
+ */
+void FramePacer::wait() {
+	if(framePeriod == 0 || vsyncPacing) {
+		return;
+	} else {
+		//Nothing to do. The frame must be paced.
+	}
+
+	Uint64 now = Timer::getNanoseconds();
+
+	if(deadline > now + SPIN_TIME) {
+		SDL_Delay((deadline - now - SPIN_TIME) / NANOSECONDS_PER_MILLISECOND);
+	} else {
+		//Nothing to do. The deadline is too close to sleep.
+	}
+
+	while(Timer::getNanoseconds() < deadline) {
+		// Spinning: SDL_Delay isn't precise enough for the last part.
+	}
+
+	now = Timer::getNanoseconds();
+	deadline += framePeriod;
+
+	if(deadline < now) {
+		deadline = now + framePeriod;
+	} else {
+		//Nothing to do. The schedule is kept.
+	}
+}
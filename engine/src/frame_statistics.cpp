@@ -0,0 +1,315 @@
+/**
+ * @file frame_statistics.cpp
+ * @brief Purpose: Contains the methods of the FrameHistogram and FrameStatistics classes.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "frame_statistics.hpp"
+#include "log.h"
+#include <cstring>
+#include <fstream>
+
+using namespace engine;
+
+const double MILLISECONDS_PER_SECOND = 1000.0;
+const double PERCENTILES[] = {50.0, 95.0, 99.0};
+const char *PHASE_NAMES[] = {"total", "update", "draw", "present"};
+const int PHASES = 4;
+
+/**
+ * @brief Default constructor for the FrameHistogram.
+ *
+ * @return "void".
+*/
+FrameHistogram::FrameHistogram() {
+	memset(mBins, 0, sizeof(mBins));
+	mOverflow = 0;
+	mCount = 0;
+	mMax = 0.0;
+}
+
+/**
+ * @brief count a duration.
+ *
+ * @param time duration (miliseconds).
+ *
+ * @return "void".
+*/
+void FrameHistogram::record(double time) {
+	if(time < 0.0) {
+		time = 0.0;
+	} else {
+		//Nothing to do. Durations can't be negative.
+	}
+
+	unsigned int bin = time / HISTOGRAM_BIN_TIME;
+
+	if(bin < HISTOGRAM_BINS) {
+		mBins[bin]++;
+	} else {
+		mOverflow++;
+	}
+
+	if(time > mMax) {
+		mMax = time;
+	} else {
+		//Nothing to do. It isn't the longest.
+	}
+
+	mCount++;
+}
+
+/**
+ * @brief duration that the given percent of the counted ones don't exceed.
+ *
+ * @param percentile between 0 and 100.
+ *
+ * @return the upper edge of the bin holding the percentile, or the max when
+ * it's past the last bin (miliseconds).
+*/
+double FrameHistogram::calcPercentile(double percentile) {
+	ASSERT(percentile >= 0.0 && percentile <= 100.0, "The percentile must be between 0 and 100.");
+
+	if(mCount == 0) {
+		return 0.0;
+	} else {
+		//Nothing to do. There are durations counted.
+	}
+
+	double wanted = mCount * percentile / 100.0;
+	unsigned int counted = 0;
+
+	for(unsigned int bin = 0; bin < HISTOGRAM_BINS; bin++) {
+		counted += mBins[bin];
+
+		if(counted >= wanted && counted > 0) {
+			double binEnd = (bin + 1) * HISTOGRAM_BIN_TIME;
+			return binEnd < mMax ? binEnd : mMax;
+		} else {
+			//Nothing to do. Keep counting.
+		}
+	}
+
+	return mMax;
+}
+
+/**
+ * @brief Default constructor for the FrameStatistics.
+ *
+ * @return "void".
+*/
+FrameStatistics::FrameStatistics() {
+	mCurrentScene = NULL;
+	mFrameBudget = 0.0;
+}
+
+/**
+ * @brief choose the scene receiving the next frames.
+ *
+ * Called on scene changes only, so recording doesn't search the map.
+ *
+ * @param sceneName name of the scene.
+ *
+ * @return "void".
+*/
+void FrameStatistics::setScene(std::string sceneName) {
+	ASSERT(sceneName != "", "The scene name can't be blank.");
+	mCurrentScene = &mSceneMap[sceneName];
+}
+
+/**
+ * @brief set the time of a frame.
+ *
+ * @param frameBudget time of a frame (miliseconds), zero disables the hitches.
+ *
+ * @return "void".
+*/
+void FrameStatistics::setFrameBudget(double frameBudget) {
+	ASSERT(frameBudget >= 0.0, "The frame budget can't be lower than zero.");
+	mFrameBudget = frameBudget;
+}
+
+/**
+ * @brief store the times of a frame on the current scene.
+ *
+ * @param totalTime whole frame, waits included (miliseconds).
+ * @param updateTime scene updates (miliseconds).
+ * @param drawTime recording and submitting the draws (miliseconds).
+ * @param presentTime SDL_RenderPresent (miliseconds).
+ * @param culledDraws draws culled outside the viewport.
+ *
+ * @return "void".
+*/
+void FrameStatistics::recordFrame(double totalTime, double updateTime, double drawTime, double presentTime,
+                                  unsigned int culledDraws) {
+	if(mCurrentScene == NULL) {
+		return;
+	} else {
+		//Nothing to do. There's a scene running.
+	}
+
+	mCurrentScene->total.record(totalTime);
+	mCurrentScene->update.record(updateTime);
+	mCurrentScene->draw.record(drawTime);
+	mCurrentScene->present.record(presentTime);
+	mCurrentScene->frameCount++;
+	mCurrentScene->totalTime += totalTime;
+	mCurrentScene->culledDraws += culledDraws;
+
+	if(mFrameBudget > 0.0 && totalTime > mFrameBudget) {
+		mCurrentScene->hitchCount++;
+	} else {
+		//Nothing to do. The frame was on time.
+	}
+}
+
+/**
+ * @brief write the report to the path set by "setOutputPath".
+ *
+ * @return false when there's no output path or the file can't be written.
+*/
+bool FrameStatistics::exportReport() {
+	if(mOutputPath == "") {
+		return false;
+	} else {
+		return exportReport(mOutputPath);
+	}
+}
+
+/**
+ * @brief write the statistics of every scene.
+ *
+ * Paths ending in ".json" get JSON, any other gets CSV.
+ *
+ * @param reportPath path of the report file.
+ *
+ * @return false when the file can't be written.
+*/
+bool FrameStatistics::exportReport(std::string reportPath) {
+	ASSERT(reportPath != "", "The report path can't be blank.");
+
+	std::ofstream report(reportPath.c_str());
+
+	if(report.is_open()) {
+		//Nothing to do. The file can be written.
+	} else {
+		WARN("Couldn't open frame statistics file " << reportPath);
+		return false;
+	}
+
+	const std::string jsonExtension = ".json";
+
+	if(reportPath.size() >= jsonExtension.size() &&
+	   reportPath.compare(reportPath.size() - jsonExtension.size(), jsonExtension.size(), jsonExtension) == 0) {
+		writeJson(report);
+	} else {
+		writeCsv(report);
+	}
+
+	INFO("Exported frame statistics to " << reportPath);
+
+	return true;
+}
+
+/**
+ * @brief calculate the average frame rate of a scene.
+ *
+ * @return the frames per second, zero when no time was recorded.
+*/
+static double calcAverageFps(SceneStatistics &scene) {
+	if(scene.totalTime > 0.0) {
+		return scene.frameCount * MILLISECONDS_PER_SECOND / scene.totalTime;
+	} else {
+		return 0.0;
+	}
+}
+
+/**
+ * @brief calculate the average draws culled per frame of a scene.
+ *
+ * @return the average culled draws, zero without frames.
+*/
+static double calcAverageCulled(SceneStatistics &scene) {
+	if(scene.frameCount > 0) {
+		return (double) scene.culledDraws / scene.frameCount;
+	} else {
+		return 0.0;
+	}
+}
+
+/**
+ * @brief access a phase histogram by its index on PHASE_NAMES.
+ *
+ * @return the histogram of the phase.
+*/
+static FrameHistogram &getPhase(SceneStatistics &scene, int phase) {
+	FrameHistogram *histograms[] = {&scene.total, &scene.update, &scene.draw, &scene.present};
+	return *histograms[phase];
+}
+
+/**
+ * @brief write one line per scene and phase.
+ *
+ * @return "void".
+*/
+void FrameStatistics::writeCsv(std::ostream &report) {
+	report << "scene,phase,frames,average_fps,hitches,culled_draws_per_frame,p50_ms,p95_ms,p99_ms,max_ms\n";
+
+	for(auto &eachScene : mSceneMap) {
+		SceneStatistics &scene = eachScene.second;
+
+		for(int phase = 0; phase < PHASES; phase++) {
+			FrameHistogram &histogram = getPhase(scene, phase);
+
+			report << eachScene.first << "," << PHASE_NAMES[phase] << ","
+			       << scene.frameCount << "," << calcAverageFps(scene) << ","
+			       << scene.hitchCount << "," << calcAverageCulled(scene);
+
+			for(double eachPercentile : PERCENTILES) {
+				report << "," << histogram.calcPercentile(eachPercentile);
+			}
+
+			report << "," << histogram.getMax() << "\n";
+		}
+	}
+}
+
+/**
+ * @brief write an object per scene with an object per phase.
+ *
+ * @return "void".
+*/
+void FrameStatistics::writeJson(std::ostream &report) {
+	report << "{\"frameBudgetMs\":" << mFrameBudget << ",\"scenes\":[";
+
+	bool firstScene = true;
+
+	for(auto &eachScene : mSceneMap) {
+		SceneStatistics &scene = eachScene.second;
+
+		report << (firstScene ? "\n" : ",\n");
+		firstScene = false;
+
+		report << "{\"scene\":\"" << eachScene.first << "\",\"frames\":" << scene.frameCount
+		       << ",\"averageFps\":" << calcAverageFps(scene)
+		       << ",\"hitches\":" << scene.hitchCount
+		       << ",\"culledDrawsPerFrame\":" << calcAverageCulled(scene);
+
+		for(int phase = 0; phase < PHASES; phase++) {
+			FrameHistogram &histogram = getPhase(scene, phase);
+
+			report << ",\"" << PHASE_NAMES[phase] << "\":{"
+			       << "\"p50\":" << histogram.calcPercentile(PERCENTILES[0])
+			       << ",\"p95\":" << histogram.calcPercentile(PERCENTILES[1])
+			       << ",\"p99\":" << histogram.calcPercentile(PERCENTILES[2])
+			       << ",\"max\":" << histogram.getMax() << "}";
+		}
+
+		report << "}";
+	}
+
+	report << "\n]}\n";
+}
@@ -12,6 +12,7 @@
 */
 #include "sdl2include.h"
 #include "game.hpp"
+#include "profiler.hpp"
 #include <iostream>
 #include <cstdlib>
 
@@ -19,6 +20,10 @@ using namespace engine; // Used to avoid write engine::Game engine::Game::instan
 
 Game Game::instance; // Used to initialize in fact the static instance of game;
 
+const double MAX_ACCUMULATED_TIME = 250.0; // Longest frame fed to the simulation (miliseconds).
+const double NANOSECONDS_PER_MILLISECOND = 1000000.0; // Nanoseconds in a millisecond, converts performance counter readings.
+const double UPLOAD_TIME_BUDGET = 2.0; // Time each frame may spend creating preloaded textures (miliseconds).
+
 /**
  * @brief Default constructor for the Game component.
  *
@@ -29,6 +34,23 @@ Game::Game(){
 	this->currentScene = NULL;
 	this->lastScene = NULL;
 	this->frameRate = 60;
+	this->simulationRate = 0;
+	this->simulationTime = 0.0;
+	this->accumulatedTime = 0.0;
+	this->interpolationFactor = 1.0;
+	this->headless = false;
+	this->drawOffscreen = false;
+	this->frameLimit = 0;
+	this->frameCount = 0;
+	this->loopStartTime = 0;
+	this->renderThread = false;
+	this->simulationRequested = false;
+	this->simulationFinished = false;
+	this->simulationStopping = false;
+	this->updateTime = 0.0;
+	this->recordTime = 0.0;
+	this->submitTime = 0.0;
+	this->presentTime = 0.0;
 }
 
 /**
@@ -39,65 +61,452 @@ Game::Game(){
  * @return "void".
 */
 void Game::run(){
+	start();
+
+	INFO("Starting Main Loop Game.");
+	while(runFrame()){
+		//Nothing to do. Each frame is run by "runFrame".
+	}
+
+	stop();
+}
+
+/**
+ * @brief Initialize SDL and prepare the main loop.
+ *
+ * Together with "runFrame" and "stop", lets a caller (such as a benchmark)
+ * drive the game frame by frame.
+ *
+ * @return "void".
+*/
+void Game::start(){
 
 	// Initialize all SDL attributes, create the window and set state to play.
 	sdlElements.initSDL();
 	sdlElements.createWindow();
+	inputManager.init();
 	gameState = engine::GameState::PLAY;
 
-	frameTime = 1000.0f / frameRate; // Calculate the time of a game frame (miliseconds).
+	// Copies outside the window are culled before reaching the renderer.
+	SDL_Rect viewport = {0, 0, sdlElements.getWindowWidth(), sdlElements.getWindowHeight()};
+	renderQueue.setViewport(viewport);
 
-	INFO("Starting Main Loop Game.");
-	while(gameState == engine::GameState::PLAY){
-		timer.step(); // Get the current time.
+	frameTime = 1000.0 / frameRate; // Calculate the time of a game frame (miliseconds).
 
-		if(startAndStopScenes() == false){
-			break;
-		}
+	// Vsync already waits in "SDL_RenderPresent", the pacer mustn't wait again.
+	framePacer.setFrameRate(frameRate);
+	framePacer.setVsync(sdlElements.hasVsync(), sdlElements.getRefreshRate(), frameRate);
 
-		SDL_Event _event; // Reading input (events).
-
-		// "Search" for a event that will close the Game.
-		while(SDL_PollEvent(&_event)){
-			switch(_event.type){
-				case SDL_QUIT:
-					gameState = engine::GameState::EXIT;
-					break;
-				default:
-					inputManager.update(_event); // Check for user inputs.
-					break;
-			}
-		}
+	if(simulationRate > 0){
+		simulationTime = 1000.0 / simulationRate; // Calculate the time of a simulation step (miliseconds).
+		INFO("Simulating with a fixed timestep of " << simulationTime << " ms.");
+	} else {
+		//Nothing to do. The simulation follows the frame time.
+	}
 
-		// Clean and Draw the Scene to refreh animations and objects.
-		SDL_RenderClear(sdlElements.getCanvas());
-		currentScene->draw();
-		SDL_RenderPresent(sdlElements.getCanvas());
+	if(frameRate > 0){
+		frameStatistics.setFrameBudget(frameTime);
+	} else {
+		//Nothing to do. There's no budget without a frame rate.
+	}
+
+	frameCount = 0;
+	loopStartTime = Timer::getNanoseconds();
+
+	if(renderThread){
+		INFO("Simulating on its own thread.");
+		simulationStopping = false;
+		simulationRequested = false;
+		simulationThread = std::thread(&Game::simulationLoop, this);
+	} else {
+		//Nothing to do. Everything runs on the main thread.
+	}
+
+	timer.Reset();
+	framePacer.start();
+}
+
+/**
+ * @brief Run one frame of the main loop.
+ *
+ * @return false when the game must stop.
+*/
+bool Game::runFrame(){
+	if(gameState != engine::GameState::PLAY){
+		return false;
+	} else {
+		//Nothing to do. The game is running.
+	}
 
-		currentScene->updateCode();
+	PROFILE_SCOPE("Game::frame");
 
-		inputManager.clear();
+	double frameStartTime = Timer::getMilliseconds();
+	updateTime = 0.0;
+	recordTime = 0.0;
+	submitTime = 0.0;
+	presentTime = 0.0;
 
-		timer.DeltaTime(); // Calculating elapsed time from the start of this frame until now.
+	timer.step(); // Get the duration of the last frame.
 
-		/**
-		 * If the time that has passed until now was faster than the frame's time,
-		 * is needed wait the time necessary to complete a frame's time.
-		*/
-		if(frameTime > timer.getDeltaTime()){
-			SDL_Delay(frameTime - timer.getDeltaTime());
+	updatePreparation();
+
+	if(startAndStopScenes() == false){
+		return false;
+	}
+
+	handleEvents();
+
+	if(headless){
+		// Headless frames don't wait for the clock: each one advances the game by one step.
+		if(simulationRate > 0){
+			timer.setDeltaTime(simulationTime);
+		} else {
+			timer.setDeltaTime(frameTime);
 		}
+	} else {
+		//Nothing to do. The timer holds the duration of the last frame.
+	}
+
+	if(renderThread){
+		runThreadedFrame();
+	} else {
+		runSerialFrame();
+	}
 
-		timer.DeltaTime();
+	frameCount++;
 
+	if(frameLimit > 0 && frameCount >= frameLimit){
+		INFO("Frame limit reached.");
+		gameState = engine::GameState::EXIT;
+	} else {
+		//Nothing to do. Keep running.
 	}
 
+	if(headless == false){
+		// Wait the time necessary to complete a frame's time.
+		PROFILE_SCOPE("FramePacer::wait");
+		framePacer.wait();
+	} else {
+		//Nothing to do. Headless frames run as fast as possible.
+	}
+
+	frameStatistics.recordFrame(
+		Timer::getMilliseconds() - frameStartTime,
+		updateTime,
+		recordTime + submitTime,
+		presentTime,
+		renderQueue.getCulledCount()
+	);
+
+	return gameState == engine::GameState::PLAY;
+}
+
+/**
+ * @brief Finish the main loop and terminate SDL.
+ *
+ * @return "void".
+*/
+void Game::stop(){
 	INFO("Finishing Main Loop.");
 
+	if(renderThread){
+		{
+			std::lock_guard<std::mutex> lock(simulationMutex);
+			simulationStopping = true;
+			simulationCondition.notify_all();
+		}
+
+		simulationThread.join();
+	} else {
+		//Nothing to do. There's no thread to stop.
+	}
+
+	renderQueue.clear();
+	assetsManager.stopPreloading();
+
+	if(headless){
+		reportThroughput((Timer::getNanoseconds() - loopStartTime) / NANOSECONDS_PER_MILLISECOND);
+	} else {
+		//Nothing to do. Windowed runs are limited by the frame rate.
+	}
+
+#ifndef NPROFILE
+	Profiler::instance.exportTrace();
+#endif
+	frameStatistics.exportReport();
+
 	INFO("Shutting down SDL.");
 	sdlElements.terminateSDL();
 }
 
+/**
+ * @brief Read the SDL events of the frame.
+ *
+ * "Search" for a event that will close the Game and send the others to the input manager.
+ *
+ * @return "void".
+*/
+void Game::handleEvents(){
+	PROFILE_SCOPE("Game::handleEvents");
+
+	SDL_Event _event; // Reading input (events).
+
+	while(SDL_PollEvent(&_event)){
+		switch(_event.type){
+			case SDL_QUIT:
+				gameState = engine::GameState::EXIT;
+				break;
+			default:
+				inputManager.update(_event); // Check for user inputs.
+				break;
+		}
+	}
+}
+
+/**
+ * @brief Draw and simulate the scene once.
+ *
+ * The simulation advances by the duration of the last frame, so slow
+ * machines take bigger steps.
+ *
+ * @return "void".
+*/
+void Game::runVariableFrame(){
+	drawFrame();
+
+	double updateStartTime = Timer::getMilliseconds();
+	physicsWorld.step();
+	currentScene->updateCode();
+	updateTime = Timer::getMilliseconds() - updateStartTime;
+
+	inputManager.clear();
+}
+
+/**
+ * @brief Simulate the scene in fixed steps and draw it interpolated.
+ *
+ * The duration of the last frame is accumulated and consumed in steps of
+ * simulationTime, so every machine runs the same simulation. What is left
+ * in the accumulator is used to blend the last two states when drawing.
+ *
+ * @return "void".
+*/
+void Game::runFixedFrame(){
+	double lastFrameTime = timer.getDeltaTime();
+
+	// Clamping avoids an endless catch up after a long stall (asset loading, debugger).
+	if(lastFrameTime > MAX_ACCUMULATED_TIME){
+		lastFrameTime = MAX_ACCUMULATED_TIME;
+	} else {
+		//Nothing to do. The frame time is acceptable.
+	}
+
+	accumulatedTime += lastFrameTime;
+
+	// Game code reads the timer, so every step sees the same delta.
+	timer.setDeltaTime(simulationTime);
+
+	double updateStartTime = Timer::getMilliseconds();
+
+	{
+		PROFILE_SCOPE("Game::simulate");
+
+		while(accumulatedTime >= simulationTime && needToChangeScene == false){
+			currentScene->storePreviousPositions();
+			camera.storePreviousPosition();
+			// Contacts are found on the state left by the last step.
+			physicsWorld.step();
+			currentScene->updateCode();
+			accumulatedTime -= simulationTime;
+
+			// The events of the frame are seen by its first step only.
+			inputManager.clear();
+		}
+	}
+
+	updateTime = Timer::getMilliseconds() - updateStartTime;
+
+	ASSERT(simulationTime > 0.0, "The simulation time must be bigger than zero.");
+	interpolationFactor = accumulatedTime / simulationTime;
+
+	drawFrame();
+}
+
+/**
+ * @brief Record the Scene draws on the render queue.
+ *
+ * Skipped by headless runs not drawing offscreen, and when the scene is about
+ * to change, since the next scene isn't initialized yet.
+ *
+ * @return "void".
+*/
+void Game::drawFrame(){
+	if((headless && drawOffscreen == false) || needToChangeScene){
+		return;
+	} else {
+		//Nothing to do. The frame must be drawn.
+	}
+
+	double recordStartTime = Timer::getMilliseconds();
+	camera.updateView(interpolationFactor);
+	currentScene->draw();
+	recordTime = Timer::getMilliseconds() - recordStartTime;
+}
+
+/**
+ * @brief Clean the canvas, submit the recorded frame and present it.
+ *
+ * @return "void".
+*/
+void Game::presentFrame(){
+	if(headless && drawOffscreen == false){
+		return;
+	} else {
+		//Nothing to do. The frame must be presented.
+	}
+
+	double submitStartTime = Timer::getMilliseconds();
+	SDL_RenderClear(sdlElements.getCanvas());
+
+	{
+		PROFILE_SCOPE("RenderQueue::submit");
+		renderQueue.submit(sdlElements.getCanvas());
+	}
+
+	double presentStartTime = Timer::getMilliseconds();
+	submitTime = presentStartTime - submitStartTime;
+
+	{
+		PROFILE_SCOPE("SDL_RenderPresent");
+		SDL_RenderPresent(sdlElements.getCanvas());
+	}
+
+	presentTime = Timer::getMilliseconds() - presentStartTime;
+}
+
+/**
+ * @brief Simulate and record the frame with the chosen timestep.
+ *
+ * @return "void".
+*/
+void Game::simulateFrame(){
+	if(simulationRate > 0){
+		runFixedFrame();
+	} else {
+		runVariableFrame();
+	}
+}
+
+/**
+ * @brief Body of the simulation thread.
+ *
+ * Waits for the main thread to request a frame, simulates and records it,
+ * then tells the main thread it's finished.
+ *
+ * @return "void".
+*/
+void Game::simulationLoop(){
+	std::unique_lock<std::mutex> lock(simulationMutex);
+
+	while(true){
+		simulationCondition.wait(lock, [this]{
+			return simulationRequested || simulationStopping;
+		});
+
+		if(simulationStopping){
+			break;
+		} else {
+			//Nothing to do. A frame was requested.
+		}
+
+		simulationRequested = false;
+		lock.unlock();
+
+		simulateFrame();
+
+		lock.lock();
+		simulationFinished = true;
+		simulationCondition.notify_all();
+	}
+}
+
+/**
+ * @brief Let the simulation thread run a frame.
+ *
+ * @return "void".
+*/
+void Game::requestSimulation(){
+	std::lock_guard<std::mutex> lock(simulationMutex);
+
+	simulationFinished = false;
+	simulationRequested = true;
+	simulationCondition.notify_all();
+}
+
+/**
+ * @brief Wait for the simulation thread to finish its frame.
+ *
+ * @return "void".
+*/
+void Game::waitSimulation(){
+	PROFILE_SCOPE("Game::waitSimulation");
+	std::unique_lock<std::mutex> lock(simulationMutex);
+
+	simulationCondition.wait(lock, [this]{
+		return simulationFinished;
+	});
+}
+
+/**
+ * @brief Run a frame with simulation and drawing overlapped.
+ *
+ * The simulation thread simulates and records this frame while the main
+ * thread submits and presents the previous one. Scenes are changed and
+ * events are read only while the simulation thread waits, so game code
+ * never runs at the same time as them.
+ *
+ * @return "void".
+*/
+void Game::runThreadedFrame(){
+	requestSimulation();
+	presentFrame();
+	waitSimulation();
+
+	renderQueue.swap();
+}
+
+/**
+ * @brief Run a frame on the main thread alone.
+ *
+ * @return "void".
+*/
+void Game::runSerialFrame(){
+	simulateFrame();
+
+	renderQueue.swap();
+	presentFrame();
+}
+
+/**
+ * @brief Log how fast the main loop ran.
+ *
+ * @param elapsedTime wall time spent in the main loop (miliseconds).
+ *
+ * @return "void".
+*/
+void Game::reportThroughput(double elapsedTime){
+	double framesPerSecond = 0.0;
+
+	if(elapsedTime > 0.0){
+		framesPerSecond = frameCount * 1000.0 / elapsedTime;
+	} else {
+		//Nothing to do. The run was too short to be measured.
+	}
+
+	INFO("Ran " << frameCount << " frames in " << elapsedTime << " ms ("
+	     << framesPerSecond << " frames per second).");
+}
+
 /**
  * @brief add scenes to the game.
  *
@@ -161,10 +570,71 @@ void Game::setAttributes(std::string gameName, int windowWidth, int windowHeight
 	this->frameRate = frameRate;
 }
 
+/**
+ * @brief set the fixed simulation rate.
+ *
+ * When bigger than zero, the scenes are updated simulationRate times per second
+ * regardless of the frame rate, and drawn interpolated between the last two steps.
+ *
+ * @param simulationRate simulation steps per second, zero simulates once per frame.
+ *
+ * @return "void".
+*/
+void Game::setSimulationRate(int simulationRate){
+	ASSERT(simulationRate >= 0, "The simulation rate can't be lower than zero.");
+	this->simulationRate = simulationRate;
+}
+
+/**
+ * @brief run without window, renderer on screen or audio device.
+ *
+ * Headless runs don't wait between frames: every frame advances the game by
+ * one simulation step (or one frame time when the fixed timestep is disabled)
+ * as fast as the machine can. Useful for benchmarks and automated checks.
+ *
+ * @param headless true to run without window.
+ * @param drawOffscreen true to keep drawing into the offscreen software canvas.
+ *
+ * @return "void".
+*/
+void Game::setHeadless(bool headless, bool drawOffscreen){
+	sdlElements.setHeadless(headless);
+	this->headless = headless;
+	this->drawOffscreen = drawOffscreen;
+}
+
+/**
+ * @brief simulate on a thread of its own.
+ *
+ * The simulation of a frame then overlaps the submission and the present
+ * (which may block on vsync) of the previous one, at the cost of showing
+ * frames one frame later.
+ *
+ * @param renderThread true to simulate on a thread of its own.
+ *
+ * @return "void".
+*/
+void Game::setRenderThread(bool renderThread){
+	this->renderThread = renderThread;
+}
+
+/**
+ * @brief set how many frames to run before exiting.
+ *
+ * @param frameLimit frames to run, zero runs until the game is closed.
+ *
+ * @return "void".
+*/
+void Game::setFrameLimit(unsigned int frameLimit){
+	this->frameLimit = frameLimit;
+}
+
 /**
  * @brief change the game scene.
  *
  * Perform the necessary checks and prepare the structure to switch Scenes.
+ * While a scene is running, the new one is prepared first and the current
+ * one keeps running until every asset of the new scene is loaded.
  *
  * @param sceneName string that has the scene name
  *
@@ -177,9 +647,69 @@ void Game::changeScene(std::string sceneName){
 		ERROR("Scene not found!");
 	}
 
-	lastScene = currentScene;
-	currentScene = sceneMap[sceneName];
-	needToChangeScene = true;
+	if(currentScene == NULL){
+		// There's nothing to show while loading the first scene.
+		currentScene = sceneMap[sceneName];
+		needToChangeScene = true;
+	} else {
+		prepareScene(sceneName);
+		nextSceneName = sceneName;
+	}
+}
+
+/**
+ * @brief start loading the assets of a scene.
+ *
+ * Images are decoded and audios loaded on a thread of their own, and the
+ * textures are created a few at a time at the start of each frame. Calling
+ * it ahead of "changeScene" (for instance when a menu opens) lets the
+ * change happen with nothing left to load.
+ *
+ * @param sceneName string that has the scene name
+ *
+ * @return "void".
+*/
+void Game::prepareScene(std::string sceneName){
+	ASSERT(sceneName != "", "The scene name can't be blank.");
+	if(sceneMap.find(sceneName) == sceneMap.end()){
+		ERROR("Scene not found!");
+		return;
+	} else {
+		//Nothing to do. The scene exists.
+	}
+
+	AssetList assetList;
+	sceneMap[sceneName]->collectAssets(assetList);
+	assetsManager.preload(assetList);
+}
+
+/**
+ * @brief upload the preloaded assets and change the scene when ready.
+ *
+ * Spends at most UPLOAD_TIME_BUDGET creating textures, and asks
+ * "startAndStopScenes" to change the scene once every asset is loaded.
+ * Headless runs load everything at once instead, so the change happens on
+ * the same frame no matter how long the loading takes.
+ *
+ * @return "void".
+*/
+void Game::updatePreparation(){
+	if(headless && nextSceneName != ""){
+		assetsManager.finishPreloading();
+	} else {
+		//Nothing to do. The assets are uploaded within the budget.
+	}
+
+	bool resident = assetsManager.uploadPreloaded(UPLOAD_TIME_BUDGET);
+
+	if(resident && nextSceneName != ""){
+		lastScene = currentScene;
+		currentScene = sceneMap[nextSceneName];
+		needToChangeScene = true;
+		nextSceneName = "";
+	} else {
+		//Nothing to do. There's no change waiting or it's still loading.
+	}
 }
 
 /**
@@ -192,31 +722,51 @@ void Game::changeScene(std::string sceneName){
  * @return bool that represents the success on change scene.
 */
 bool Game::startAndStopScenes(){
+	PROFILE_SCOPE("Game::startAndStopScenes");
+
 	if(needToChangeScene){
 		if(currentScene == NULL){
 			ERROR("No scenes to run!");
 			return false;
 		}else{
-			// If the last scene is equal the current scene, we still need
-			// to delete all keys from the game object map on scene.
-			if(lastScene != NULL && lastScene->getSceneName() == currentScene->getSceneName()){
-				currentScene->deleteKeyList();
-			}
+			bool sameScene = lastScene != NULL && lastScene->getSceneName() == currentScene->getSceneName();
 
-			if (currentScene->mState == SceneState::RUNNED) {
-				currentScene->restart();
-				currentScene->mState = SceneState::FIRST_TIME;
+			if(sameScene && currentScene->hasSnapshot()){
+				// Restarting the running scene: put it back as it was after its init.
+				currentScene->restoreSnapshot();
 			} else {
-				//Nothing to do, scene state is different
-			}
+				// If the last scene is equal the current scene, we still need
+				// to delete all keys from the game object map on scene.
+				if(sameScene){
+					currentScene->deleteKeyList();
+				}
 
-			if (currentScene->mState == SceneState::FIRST_TIME) {
-				currentScene->mState = SceneState::RUNNED;
-			} else {
-				//Nothing to do, scene state is different
+				if (currentScene->mState == SceneState::RUNNED) {
+					currentScene->restart();
+					currentScene->mState = SceneState::FIRST_TIME;
+				} else {
+					//Nothing to do, scene state is different
+				}
+
+				if (currentScene->mState == SceneState::FIRST_TIME) {
+					currentScene->mState = SceneState::RUNNED;
+				} else {
+					//Nothing to do, scene state is different
+				}
+
+				// Colliders and components register on init, the ones of the last scene mustn't stay.
+				// Scenes start with the camera on the origin of their world.
+				physicsWorld.clear();
+				componentSystems.clear();
+				camera.reset();
+				currentScene->init();
+				currentScene->saveSnapshot();
 			}
 
-			currentScene->init();
+			frameStatistics.setScene(currentScene->getSceneName());
+
+			// The new scene starts with a clean accumulator.
+			accumulatedTime = 0.0;
 
 			if(lastScene != NULL){
 				INFO("Shuting down scene!");
@@ -13,10 +13,15 @@
 #include "game_object.hpp"
 #include "game.hpp"
 #include "log.h"
+#include "profiler.hpp"
 #include "code_component.hpp"
+#include "state_buffer.hpp"
 
 using namespace engine; // Used to avoid write engine::Game engine::Game::instance;.
 
+// Bytes of each chunk of the arena of a game object built without one.
+const std::size_t GAME_OBJECT_ARENA_CHUNK_SIZE = 4 * 1024;
+
 /**
  * @brief Default constructor for the Game Object component.
  *  
@@ -29,6 +34,22 @@ GameObject::GameObject(){
 	mHalfSize.second = 0;
 }
 
+/**
+ * @brief Destructor for the game object.
+ *
+ * free the parts the game object built, unless they're on the arena of its
+ * scene.
+ *
+ * @return "void".
+*/
+GameObject::~GameObject(){
+	if (mOwnsArena){
+		delete mArena;
+	} else {
+		//Nothing to do. The parts go with the arena they're on.
+	}
+}
+
 
 /**
  * @brief Constructor for the game object.
@@ -50,60 +71,64 @@ GameObject::GameObject(std::string gameObjectName, std::pair<double, double> cur
 
 
 /**
- * @brief add components to the game.
- *  
- * set the position and insert the game components.
- * 
- * @param component that is added to the game.
- * 
+ * @brief build the parts of the game object on an arena.
+ *
+ * Game objects built on the arena of their scene put their parts there too,
+ * so they're released with the scene. Must be set before the first part is
+ * built.
+ *
+ * @param arena arena that outlives the game object.
+ *
  * @return "void".
 */
-void GameObject::addComponent(Component &component){
-	ASSERT(&component != NULL, "The component can't be null.");
-	std::pair <std::type_index, Component *> componentPair(typeid(component), &component);
-	mComponentMap.insert(componentPair);
+void GameObject::setArena(Arena &arena){
+	ASSERT(mArena == NULL, "The arena must be set before the first part is built.");
+	mArena = &arena;
 }
 
-
 /**
- * @brief retrieve the animation controller.
- *  
- * find and sets the animation controller.
- * 
- * @param index of components that has the component type.
- * 
- * @return the game object Animation Controller.
+ * @brief access the arena the parts are built on.
+ *
+ * Game objects without an arena get one of their own.
+ *
+ * @return the arena of the game object.
 */
-AnimationController* GameObject::getAnimationController(std::type_index componentType){
-	auto componentToBeFound = mComponentMap.find(componentType);
-	if (componentToBeFound != mComponentMap.end()){
-		DEBUG("AnimationController found. Class name: " << componentToBeFound->second->getClassName());
-		return dynamic_cast <AnimationController * > (componentToBeFound->second);
+Arena &GameObject::getArena(){
+	if (mArena == NULL){
+		mArena = new Arena(GAME_OBJECT_ARENA_CHUNK_SIZE);
+		mOwnsArena = true;
 	} else {
-		ERROR("Animation Controller couldn't be found!");
+		//Nothing to do. The arena was set or built already.
 	}
-}
 
+	return *mArena;
+}
 
 /**
- * @brief retrieve the audio controller.
+ * @brief add components to the game.
  *  
- * find and sets the audio controller.
+ * insert the component and keep it as the one of its type, unless the game
+ * object has one already.
  * 
- * @param index of components that has the component type.
+ * @param component that is added to the game.
+ * @param typeId ComponentType number of the type it's added as.
  * 
- * @return the game object Audio Controller.
+ * @return "void".
 */
-AudioController* GameObject::getAudioController(std::type_index componentType){
-	ASSERT(&componentType != NULL, "The component type can't be null.");
-	auto componentToBeFound = mComponentMap.find(componentType);
-	ASSERT(&componentToBeFound != NULL, "The component can't be null.");
-
-	if (componentToBeFound != mComponentMap.end()){
-		DEBUG("AudioController found. Class name: " << componentToBeFound->second->getClassName());
-		return dynamic_cast <AudioController * > (componentToBeFound->second);
+void GameObject::registerComponent(Component &component, unsigned int typeId){
+	ASSERT(&component != NULL, "The component can't be null.");
+	mComponentList.push_back(&component);
+
+	if (typeId >= mComponentTypeList.size()){
+		mComponentTypeList.resize(typeId + 1, NULL);
+	} else {
+		//Nothing to do. The list has room for the type.
+	}
+
+	if (mComponentTypeList[typeId] == NULL){
+		mComponentTypeList[typeId] = &component;
 	} else {
-		ERROR("Audio Controller couldn't be found!");
+		//Nothing to do. The first component of the type is kept.
 	}
 }
 
@@ -116,8 +141,9 @@ AudioController* GameObject::getAudioController(std::type_index componentType){
  * @return "void".
 */
 void GameObject::init(){
-	for (auto eachPair : mComponentMap){
-		auto component = eachPair.second;
+	storePreviousPosition();
+
+	for (auto component : mComponentList){
 		if (component->isEnabled()){
 			component->init();
 		}
@@ -126,50 +152,120 @@ void GameObject::init(){
 
 
 /**
- * @brief function that draw game objects components.  
- * 
- * draws all the enabled game objects components.
+ * @brief function that update the game object code.  
  * 
+ * update all the enabled game object components. Animations and audios
+ * are updated by their systems instead.
+ *  
  * @return "void".
 */
-void GameObject::draw(){
-	for (auto eachPair : mComponentMap){
-		auto component = eachPair.second;
-
-		ASSERT(component != NULL, "Component can't be NULL when drawing.");
+void GameObject::updateCode(){
+	PROFILE_SCOPE("GameObject::updateCode");
 
+	for (auto component : mComponentList){
 		if (component->isEnabled()){
-			component->draw();
+			component->updateCode();
 		}
 	}
 }
 
 
 /**
- * @brief function that update the game object code.  
+ * @brief inherits function that disable the game components.
  * 
- * update all the enabled game object components.
+ * free the component pointers.
  *  
  * @return "void".
 */
-void GameObject::updateCode(){
-	for (auto eachPair : mComponentMap){
-		auto component = eachPair.second;
-		if (component->isEnabled()){
-			component->updateCode();
-		}
+void GameObject::shutdown(){}
+
+
+/**
+ * @brief list the assets of the game object components.
+ *
+ * collect the assets every component loads on its init.
+ *
+ * @param assetList list that receives the asset paths.
+ *
+ * @return "void".
+*/
+void GameObject::collectAssets(AssetList &assetList){
+	for (auto component : mComponentList){
+
+		ASSERT(component != NULL, "Component can't be NULL when collecting assets.");
+
+		component->collectAssets(assetList);
 	}
 }
 
 
 /**
- * @brief inherits function that disable the game components.
- * 
- * free the component pointers.
- *  
+ * @brief write the mutable state of the game object and its components.
+ *
+ * Game objects with more state must extend it, and read everything back
+ * in the same order on "loadState".
+ *
+ * @param stateBuffer buffer that receives the state.
+ *
  * @return "void".
 */
-void GameObject::shutdown(){}
+void GameObject::saveState(StateBuffer &stateBuffer){
+	stateBuffer.write(getWorldPosition());
+	stateBuffer.write(mLocalPosition);
+	stateBuffer.write(mPreviousPosition);
+	stateBuffer.write(mSize);
+	stateBuffer.write(mCenter);
+	stateBuffer.write(mHalfSize);
+	stateBuffer.write(mObjectState);
+
+	for (auto component : mComponentList){
+		component->saveState(stateBuffer);
+	}
+}
+
+
+/**
+ * @brief read back the state written by "saveState".
+ *
+ * @param stateBuffer buffer that holds the state.
+ *
+ * @return "void".
+*/
+void GameObject::loadState(StateBuffer &stateBuffer){
+	stateBuffer.read(mCurrentPosition);
+	stateBuffer.read(mLocalPosition);
+	stateBuffer.read(mPreviousPosition);
+	stateBuffer.read(mSize);
+	stateBuffer.read(mCenter);
+	stateBuffer.read(mHalfSize);
+	stateBuffer.read(mObjectState);
+	// The world position is rebuilt from the local one on its next use, the
+	// parent may be read back after the game object.
+	mTransformDirty = true;
+
+	for (auto component : mComponentList){
+		component->loadState(stateBuffer);
+	}
+}
+
+
+/**
+ * @brief pass a collision event to the game object components.
+ *
+ * Only enabled components receive it.
+ *
+ * @param event whether the colliders started, kept or stopped touching.
+ * @param other collider touched by the game object.
+ *
+ * @return "void".
+*/
+void GameObject::onCollision(CollisionEvent event, ColliderComponent &other){
+	for (auto component : mComponentList){
+		if (component->isEnabled()){
+			component->onCollision(event, other);
+		}
+	}
+}
 
 
 /**
@@ -278,3 +374,134 @@ std::pair<double, double> GameObject::calcLeftUp(){
 std::pair<double, double> GameObject::calcLeftDown(){
 	return calcBottomLeft();
 }
+
+
+/**
+ * @brief keep the position of the last simulation step.
+ *
+ * @return "void".
+*/
+void GameObject::storePreviousPosition(){
+	mPreviousPosition = getWorldPosition();
+}
+
+
+/**
+ * @brief calculate the position to draw the game object.
+ *
+ * blend the position of the last simulation step with the current one.
+ *
+ * @param interpolationFactor 0.0 for the previous position, 1.0 for the current one.
+ *
+ * @return a pair containing the left upper corner to draw the game object.
+*/
+std::pair<double, double> GameObject::calcInterpolatedPosition(double interpolationFactor){
+	getWorldPosition();
+
+	std::pair<double, double> interpolatedPosition;
+	interpolatedPosition.first = mPreviousPosition.first
+		+ (mCurrentPosition.first - mPreviousPosition.first) * interpolationFactor;
+	interpolatedPosition.second = mPreviousPosition.second
+		+ (mCurrentPosition.second - mPreviousPosition.second) * interpolationFactor;
+	return interpolatedPosition;
+}
+
+
+/**
+ * @brief calculate where the game object is drawn on the screen.
+ *
+ * the interpolated position seen from the camera, unless the game object
+ * is fixed on the screen.
+ *
+ * @param interpolationFactor 0.0 for the previous position, 1.0 for the current one.
+ *
+ * @return a pair containing the left upper corner on the screen.
+*/
+std::pair<double, double> GameObject::calcScreenPosition(double interpolationFactor){
+	std::pair<double, double> screenPosition = calcInterpolatedPosition(interpolationFactor);
+
+	if (mFixedOnScreen == false){
+		const std::pair<double, double> &viewPosition = Game::instance.getCamera().getViewPosition();
+		screenPosition.first -= viewPosition.first;
+		screenPosition.second -= viewPosition.second;
+	} else {
+		//Nothing to do. The game object is placed on the screen.
+	}
+
+	return screenPosition;
+}
+
+/**
+ * @brief make the position of the game object relative to another one.
+ *
+ * the local position is kept, so the game object moves along with its new
+ * parent from where it is on it.
+ *
+ * @param parent game object to follow, NULL to be placed on the world.
+ *
+ * @return "void".
+*/
+void GameObject::setParent(GameObject *parent){
+	for (GameObject *ancestor = parent; ancestor != NULL; ancestor = ancestor->mTransformParent){
+		ASSERT(ancestor != this, "A game object can't be its own parent.");
+	}
+
+	if (parent == NULL && mTransformParent != NULL){
+		mCurrentPosition = mLocalPosition;
+	} else {
+		//Nothing to do. The position is resolved when it's needed.
+	}
+
+	mTransformParent = parent;
+	mTransformDirty = true;
+}
+
+
+/**
+ * @brief place the game object on its parent.
+ *
+ * the world position is only resolved when it's needed. Without a parent
+ * the local position is the world one.
+ *
+ * @param localPosition left upper corner relative to the parent.
+ *
+ * @return "void".
+*/
+void GameObject::setLocalPosition(std::pair<double, double> localPosition){
+	mLocalPosition = localPosition;
+
+	if (mTransformParent == NULL){
+		mCurrentPosition = localPosition;
+	} else {
+		mTransformDirty = true;
+	}
+}
+
+
+/**
+ * @brief resolve the position of the game object on the world.
+ *
+ * mCurrentPosition is only calculated again when the local position
+ * changed or the parent moved since the last call, so a parent moving
+ * costs nothing to the children that aren't looked at.
+ *
+ * @return the left upper corner of the game object on the world.
+*/
+const std::pair<double, double> &GameObject::getWorldPosition(){
+	if (mTransformParent != NULL){
+		const std::pair<double, double> &parentPosition = mTransformParent->getWorldPosition();
+
+		if (mTransformDirty || parentPosition != mResolvedParentPosition){
+			mResolvedParentPosition = parentPosition;
+			mCurrentPosition.first = parentPosition.first + mLocalPosition.first;
+			mCurrentPosition.second = parentPosition.second + mLocalPosition.second;
+			mTransformDirty = false;
+		} else {
+			//Nothing to do. Neither the game object nor its parent moved.
+		}
+	} else {
+		//Nothing to do. The game object is placed on the world.
+	}
+
+	return mCurrentPosition;
+}
@@ -53,7 +53,18 @@ ImageComponent::ImageComponent(
 
 void ImageComponent::init() {
 	DEBUG("Calling ImageComponent::init");
+	loadImage();
+	Game::instance.getComponentSystems().mImagePool.add(*this);
+}
+
+void ImageComponent::shutdown() {
+	DEBUG("Calling ImageComponent::shutdown");
+	Game::instance.getComponentSystems().mImagePool.remove(*this);
+	imageTexture = NULL;
+}
 
+// Takes the texture and the measures of the image, and sizes the game object to them.
+void ImageComponent::loadImage() {
 	//Check AssetsManager to see if image is already loaded.
 	auto assetsImage = Game::instance.getAssetsManager().LoadImage(imagePath);
 	ASSERT(
@@ -69,9 +80,11 @@ void ImageComponent::init() {
 	gameObject->mSize.first = componentWidth;
 	gameObject->mSize.second = componentHeight;
 
+	const std::pair<double, double> &position = gameObject->getWorldPosition();
+
 	canvasQuad = {
-		(int)(gameObject->mCurrentPosition.first + mPositionRelativeToObject.first),
-		(int)(gameObject->mCurrentPosition.second + mPositionRelativeToObject.second),
+		(int)(position.first + mPositionRelativeToObject.first),
+		(int)(position.second + mPositionRelativeToObject.second),
 		componentWidth,
 		componentHeight
 	};
@@ -84,20 +97,25 @@ void ImageComponent::draw() {
 	//DEBUG("Calling ImageComponent::draw");
 
 	updateQuad();
-	SDL_RenderCopy(
-		Game::instance.sdlElements.getCanvas(),
+	Game::instance.getRenderQueue().push(
 		imageTexture,
-		&renderQuad,
-		&canvasQuad
+		renderQuad,
+		&canvasQuad,
+		gameObject->mLayer,
+		gameObject->mDrawOrder
 	);
 }
 
 void ImageComponent::updateQuad() {
 	//DEBUG("Calling ImageComponent::updateQuad");
 
+	std::pair<double, double> drawPosition = gameObject->calcScreenPosition(
+		Game::instance.getInterpolationFactor()
+	);
+
 	canvasQuad = {
-		(int)(gameObject->mCurrentPosition.first + mPositionRelativeToObject.first),
-		(int)(gameObject->mCurrentPosition.second + mPositionRelativeToObject.second),
+		(int)(drawPosition.first + mPositionRelativeToObject.first),
+		(int)(drawPosition.second + mPositionRelativeToObject.second),
 		componentWidth,
 		componentHeight
 	};
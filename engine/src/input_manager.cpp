@@ -8,6 +8,7 @@
  * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
 */
 #include "input_manager.hpp"
+#include <cstring>
 
 using namespace engine;// Used to avoid write engine::Game engine::Game::instance;.
 
@@ -16,32 +17,106 @@ using namespace engine;// Used to avoid write engine::Game engine::Game::instanc
 *
 * @return "void".
 */
-InputManager::InputManager() {}
+InputManager::InputManager() {
+	mLastEventType = 0;
+	keyboardStates = NULL;
+	memset(mScriptedStates, 0, sizeof(mScriptedStates));
+	mScripted = false;
+}
 InputManager::~InputManager() {}
 
+/**
+* @brief fetch the keyboard state array.
+*
+* Must be called after SDL is initialized. Without it the keyboard states
+* stay NULL until the first event, and headless runs may get no events at all.
+*
+* @return "void".
+*/
+void InputManager::init() {
+	if (mScripted) {
+		return;
+	} else {
+		//Nothing to do. The keyboard is read.
+	}
+
+	DEBUG("Getting Keyboard State");
+	keyboardStates = SDL_GetKeyboardState(NULL);
+	ASSERT(keyboardStates != NULL, "Keyboard states can't be null.");
+}
+
+/**
+* @brief read the keys from a script instead of the keyboard.
+*
+* Used to replay the same input on every run, e.g. on benchmarks.
+*
+* @param scripted true to read the keys set by "pressKey" and "releaseKey".
+*
+* @return "void".
+*/
+void InputManager::setScripted(bool scripted) {
+	mScripted = scripted;
+
+	if (mScripted) {
+		keyboardStates = mScriptedStates;
+	} else {
+		keyboardStates = SDL_GetKeyboardState(NULL);
+	}
+}
+
+/**
+* @brief hold a button down on the script.
+*
+* @param Button that represent user input.
+*
+* @return "void".
+*/
+void InputManager::pressKey(Button button) {
+	ASSERT(mScripted, "Keys can only be pressed on scripted input.");
+	mScriptedStates[button] = 1;
+}
+
+/**
+* @brief release a button on the script.
+*
+* Also queues the key up event, so "keyDownOnce" sees it on the next frame.
+*
+* @param Button that represent user input.
+*
+* @return "void".
+*/
+void InputManager::releaseKey(Button button) {
+	ASSERT(mScripted, "Keys can only be released on scripted input.");
+	mScriptedStates[button] = 0;
+
+	SDL_Event keyUpEvent;
+	memset(&keyUpEvent, 0, sizeof(keyUpEvent));
+	keyUpEvent.type = SDL_KEYUP;
+	keyUpEvent.key.keysym.scancode = (SDL_Scancode) button;
+	mEventList.push_back(keyUpEvent);
+}
+
 /**
 * @brief test if button is pressed once.
 *
-* Used to set the test of key down only once.
+* Used to set the test of key down only once. The button counts once, when
+* it's released, so holding it doesn't repeat. Only the events of the frame
+* are read: events aren't pumped here, so it's safe on the simulation thread.
 *
 * @param Button that represent user input.
 *
-* @return a bool that indicates the add scene success.
+* @return a bool that indicates if the button was released on this frame.
 */
 
 bool InputManager::keyDownOnce(Button button) {
 	ASSERT(button != -1, "button path can't be -1.");
-	if (keyboardStates[button]) {
-		SDL_PumpEvents();
-		DEBUG("Button " << button << " is being Pressed");
-		if (!keyboardStates[button]) {
+	for (auto &eachEvent : mEventList) {
+		if (eachEvent.type == SDL_KEYUP && eachEvent.key.keysym.scancode == (SDL_Scancode) button) {
 			DEBUG("Button " << button << " is Released");
 			return true;
 		} else {
-			//Nothing to do for the keyboardStates matches button
+			//Nothing to do for the event doesn't match button
 		}
-	} else {
-		//Nothing to do for there's no SDL_Event
 	}
 	return false;
 
@@ -83,7 +158,12 @@ void InputManager::clear() {
 * @return  "void".
 */
 void InputManager::update(SDL_Event _event) {
-	DEBUG("Getting Keyboard State");
 	mEventList.push_back(_event);
-	keyboardStates = SDL_GetKeyboardState(NULL);
+
+	if (mScripted == false) {
+		DEBUG("Getting Keyboard State");
+		keyboardStates = SDL_GetKeyboardState(NULL);
+	} else {
+		//Nothing to do. The keys come from the script.
+	}
 }
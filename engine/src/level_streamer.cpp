@@ -0,0 +1,165 @@
+/**
+ * @file level_streamer.cpp
+ * @brief Purpose: Contains the methods of the LevelStreamer class.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "level_streamer.hpp"
+
+using namespace engine;
+
+/**
+ * @brief Constructor for the LevelStreamer.
+ *
+ * The level has no chunks until "setChunkCount".
+ *
+ * @param chunkLoader builds and takes down the chunks.
+ * @param chunkWidth width of each chunk (pixels).
+ * @param chunksBehind chunks kept loaded behind the camera.
+ * @param chunksAhead chunks loaded ahead of the camera.
+ *
+ * @return "void".
+*/
+LevelStreamer::LevelStreamer(ChunkLoader &chunkLoader, double chunkWidth, unsigned int chunksBehind,
+                             unsigned int chunksAhead) {
+	ASSERT(chunkWidth > 0.0, "The chunk width must be positive.");
+	mChunkLoader = &chunkLoader;
+	mChunkWidth = chunkWidth;
+	mChunksBehind = chunksBehind;
+	mChunksAhead = chunksAhead;
+	mChunkCount = 0;
+	mFirstLoaded = 0;
+	mLoadedEnd = 0;
+}
+
+/**
+ * @brief set how many chunks the level has.
+ *
+ * Must be called while no chunk is loaded.
+ *
+ * @param chunkCount number of chunks of the level.
+ *
+ * @return "void".
+*/
+void LevelStreamer::setChunkCount(unsigned int chunkCount) {
+	ASSERT(mFirstLoaded == mLoadedEnd, "The chunks must be released before changing the level.");
+	mChunkCount = chunkCount;
+}
+
+/**
+ * @brief find the chunk of a position.
+ *
+ * @param position horizontal position on the level (pixels).
+ *
+ * @return number of the chunk, the first one for positions before it.
+*/
+unsigned int LevelStreamer::getChunk(double position) {
+	if (position > 0.0) {
+		return static_cast<unsigned int>(position / mChunkWidth);
+	} else {
+		return 0;
+	}
+}
+
+/**
+ * @brief count the chunks loaded at most.
+ *
+ * A view can touch one chunk more than it fills.
+ *
+ * @param viewWidth width seen by the camera (pixels).
+ *
+ * @return most chunks loaded at the same time.
+*/
+unsigned int LevelStreamer::getMaxLoadedChunks(double viewWidth) {
+	ASSERT(viewWidth >= 0.0, "The view width can't be negative.");
+	return mChunksBehind + static_cast<unsigned int>(viewWidth / mChunkWidth) + 2 + mChunksAhead;
+}
+
+/**
+ * @brief find where the window loaded for a camera ends.
+ *
+ * @param viewLeft left side of the camera on the level (pixels).
+ * @param viewWidth width seen by the camera (pixels).
+ *
+ * @return the chunk after the last one loaded, at most the chunk count.
+*/
+unsigned int LevelStreamer::getLoadedEnd(double viewLeft, double viewWidth) {
+	ASSERT(viewWidth >= 0.0, "The view width can't be negative.");
+	unsigned int loadedEnd = getChunk(viewLeft + viewWidth) + mChunksAhead + 1;
+
+	if (loadedEnd > mChunkCount) {
+		loadedEnd = mChunkCount;
+	} else {
+		//Nothing to do. The window is inside the level.
+	}
+
+	return loadedEnd;
+}
+
+/**
+ * @brief move the loaded window to the camera.
+ *
+ * Chunks leaving the window are released first, oldest first, so a loader
+ * can reuse what they took for the chunks entering it, which are loaded
+ * in order.
+ *
+ * @param viewLeft left side of the camera on the level (pixels).
+ * @param viewWidth width seen by the camera (pixels).
+ *
+ * @return "void".
+*/
+void LevelStreamer::update(double viewLeft, double viewWidth) {
+	ASSERT(viewWidth >= 0.0, "The view width can't be negative.");
+	unsigned int firstSeen = getChunk(viewLeft);
+	unsigned int firstLoaded = firstSeen > mChunksBehind ? firstSeen - mChunksBehind : 0;
+	unsigned int loadedEnd = getLoadedEnd(viewLeft, viewWidth);
+
+	if (firstLoaded > loadedEnd) {
+		// The camera is past the end of the level.
+		firstLoaded = loadedEnd;
+	} else {
+		//Nothing to do.
+	}
+
+	if (firstLoaded == mFirstLoaded && loadedEnd == mLoadedEnd) {
+		return;
+	} else {
+		//Nothing to do. The window moved.
+	}
+
+	for (unsigned int chunk = mFirstLoaded; chunk < mLoadedEnd; chunk++) {
+		if (chunk < firstLoaded || chunk >= loadedEnd) {
+			mChunkLoader->releaseChunk(chunk);
+		} else {
+			//Nothing to do. The chunk stays loaded.
+		}
+	}
+
+	for (unsigned int chunk = firstLoaded; chunk < loadedEnd; chunk++) {
+		if (!isLoaded(chunk)) {
+			mChunkLoader->loadChunk(chunk);
+		} else {
+			//Nothing to do. The chunk is already loaded.
+		}
+	}
+
+	mFirstLoaded = firstLoaded;
+	mLoadedEnd = loadedEnd;
+}
+
+/**
+ * @brief release every loaded chunk.
+ *
+ * @return "void".
+*/
+void LevelStreamer::releaseAll() {
+	for (unsigned int chunk = mFirstLoaded; chunk < mLoadedEnd; chunk++) {
+		mChunkLoader->releaseChunk(chunk);
+	}
+
+	mFirstLoaded = 0;
+	mLoadedEnd = 0;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Purpose: Contains the methods of the MappedFile class.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "mapped_file.hpp"
+#include "log.h"
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace engine;
+
+/**
+ * @brief Default constructor for the MappedFile.
+ *
+ * @return "void".
+*/
+MappedFile::MappedFile() {
+	mData = NULL;
+	mSize = 0;
+	mMapped = false;
+}
+
+/**
+ * @brief Destructor for the MappedFile.
+ *
+ * @return "void".
+*/
+MappedFile::~MappedFile() {
+	close();
+}
+
+/**
+ * @brief open a file, closing the one that was open.
+ *
+ * @param path path of the file.
+ *
+ * @return true when the file could be opened and isn't empty.
+*/
+bool MappedFile::open(std::string path) {
+	close();
+
+#ifndef _WIN32
+	int descriptor = ::open(path.c_str(), O_RDONLY);
+
+	if (descriptor < 0) {
+		INFO("Can't open " << path);
+		return false;
+	} else {
+		//Nothing to do.
+	}
+
+	struct stat fileStatus;
+
+	if (fstat(descriptor, &fileStatus) == 0 && fileStatus.st_size > 0) {
+		void *data = mmap(NULL, fileStatus.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+		if (data != MAP_FAILED) {
+			mData = static_cast<const unsigned char *>(data);
+			mSize = fileStatus.st_size;
+			mMapped = true;
+		} else {
+			INFO("Can't map " << path);
+		}
+	} else {
+		INFO("Can't read the size of " << path);
+	}
+
+	// The mapping stays valid once the descriptor is closed.
+	::close(descriptor);
+#else
+	std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+
+	if (file.is_open()) {
+		mBuffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+		if (!mBuffer.empty()) {
+			mData = &mBuffer[0];
+			mSize = mBuffer.size();
+		} else {
+			//Nothing to do. The file is empty.
+		}
+	} else {
+		INFO("Can't open " << path);
+	}
+#endif
+
+	return mData != NULL;
+}
+
+/**
+ * @brief close the file.
+ *
+ * Pointers to its bytes become invalid.
+ *
+ * @return "void".
+*/
+void MappedFile::close() {
+#ifndef _WIN32
+	if (mMapped) {
+		munmap(const_cast<unsigned char *>(mData), mSize);
+	} else {
+		//Nothing to do. The file wasn't mapped.
+	}
+#endif
+
+	mBuffer.clear();
+	mData = NULL;
+	mSize = 0;
+	mMapped = false;
+}
@@ -0,0 +1,398 @@
+/**
+ * @file physics_world.cpp
+ * @brief Purpose: Contains the methods of the PhysicsWorld class.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "physics_world.hpp"
+#include "profiler.hpp"
+#include "log.h"
+#include <algorithm>
+
+using namespace engine;
+
+const double COLLISION_CELL_WIDTH = 256.0; // About a third of the screen (pixels).
+
+/**
+ * @brief Default constructor for the PhysicsWorld.
+ *
+ * @return "void".
+*/
+PhysicsWorld::PhysicsWorld() : mCollisionGrid(COLLISION_CELL_WIDTH) {
+	clear();
+}
+
+/**
+ * @brief drop every collider and the origin.
+ *
+ * Called before a scene is initialized, so colliders of other scenes
+ * can't be left behind.
+ *
+ * @return "void".
+*/
+void PhysicsWorld::clear() {
+	mSolidList.clear();
+	mColliderList.clear();
+	mBoxList.clear();
+	mCollisionWorld.clear();
+	mCollisionGrid.clear();
+	mEventList.clear();
+	mSolidsChanged = false;
+	mOrigin = NULL;
+	mOriginPosition = std::make_pair(0.0, 0.0);
+}
+
+/**
+ * @brief put a collider on the world.
+ *
+ * @param collider collider to be added.
+ *
+ * @return "void".
+*/
+void PhysicsWorld::addCollider(ColliderComponent &collider) {
+	collider.mHasLastBox = false;
+	collider.mTouchingList.clear();
+	collider.mFoundList.clear();
+	collider.mContactManifold.clear();
+
+	if (collider.mColliderType == ColliderType::STATIC && !collider.mTrigger) {
+		mSolidList.push_back(&collider);
+		mSolidsChanged = true;
+	} else {
+		mColliderList.push_back(&collider);
+	}
+}
+
+/**
+ * @brief take a collider out of the world.
+ *
+ * Colliders that aren't on the world are ignored. Nothing is told to the
+ * colliders touching it, and its events still waiting are dropped.
+ *
+ * @param collider collider to be removed.
+ *
+ * @return "void".
+*/
+void PhysicsWorld::removeCollider(ColliderComponent &collider) {
+	auto solidPosition = std::find(mSolidList.begin(), mSolidList.end(), &collider);
+
+	if (solidPosition != mSolidList.end()) {
+		mSolidList.erase(solidPosition);
+		mSolidsChanged = true;
+	} else {
+		//Nothing to do. The collider isn't a solid.
+	}
+
+	auto colliderPosition = std::find(mColliderList.begin(), mColliderList.end(), &collider);
+
+	if (colliderPosition != mColliderList.end()) {
+		mColliderList.erase(colliderPosition);
+	} else {
+		//Nothing to do. The collider isn't dynamic or a trigger.
+	}
+
+	for (auto eachCollider : mColliderList) {
+		auto touchingList = &eachCollider->mTouchingList;
+		touchingList->erase(std::remove(touchingList->begin(), touchingList->end(), &collider), touchingList->end());
+	}
+
+	// Entries are only marked, the list may be the one being delivered.
+	for (auto &eachEntry : mEventList) {
+		if (eachEntry.receiver == &collider || eachEntry.other == &collider) {
+			eachEntry.receiver = NULL;
+		} else {
+			//Nothing to do.
+		}
+	}
+}
+
+/**
+ * @brief set the game object at the origin of the world.
+ *
+ * Static colliders are kept relative to it, so they follow it without
+ * being moved one by one. They must be on the right place relative to
+ * the origin when the next step runs. Scrolling levels don't need it,
+ * the camera moves instead; it's kept for scenes that move a whole level,
+ * such as the benchmark stress level.
+ *
+ * @param origin game object at the origin, NULL for the world itself.
+ *
+ * @return "void".
+*/
+void PhysicsWorld::setOrigin(GameObject *origin) {
+	mOrigin = origin;
+	mSolidsChanged = true;
+}
+
+/**
+ * @brief find every contact of the dynamic colliders and report them.
+ *
+ * Game objects are only told once every collider was tested.
+ *
+ * @return "void".
+*/
+void PhysicsWorld::step() {
+	PROFILE_SCOPE("PhysicsWorld::step");
+
+	if (mOrigin != NULL) {
+		mOriginPosition = mOrigin->mCurrentPosition;
+	} else {
+		mOriginPosition = std::make_pair(0.0, 0.0);
+	}
+
+	if (mSolidsChanged) {
+		indexSolids();
+	} else {
+		//Nothing to do. The solids didn't change since the last step.
+	}
+
+	indexColliders();
+
+	for (unsigned int id = 0; id < mColliderList.size(); id++) {
+		ColliderComponent *collider = mColliderList[id];
+
+		if (collider->mColliderType == ColliderType::DYNAMIC && isActive(*collider)) {
+			findContacts(id);
+		} else {
+			//Nothing to do. Only dynamic colliders look for contacts.
+		}
+	}
+
+	for (unsigned int id = 0; id < mColliderList.size(); id++) {
+		ColliderComponent *collider = mColliderList[id];
+
+		if (collider->mColliderType == ColliderType::DYNAMIC && isActive(*collider)) {
+			notifyContacts(*collider);
+		} else {
+			//Nothing to do.
+		}
+	}
+
+	deliverEvents();
+}
+
+/**
+ * @brief put the static solids on the collision world.
+ *
+ * @return "void".
+*/
+void PhysicsWorld::indexSolids() {
+	mCollisionWorld.clear();
+
+	for (auto eachSolid : mSolidList) {
+		mCollisionWorld.addBox(shiftBox(eachSolid->calcBox(), -mOriginPosition.first, -mOriginPosition.second));
+	}
+
+	mSolidsChanged = false;
+}
+
+/**
+ * @brief put the active dynamic colliders and triggers on the grid.
+ *
+ * @return "void".
+*/
+void PhysicsWorld::indexColliders() {
+	mCollisionGrid.clear();
+	mBoxList.resize(mColliderList.size());
+
+	for (unsigned int id = 0; id < mColliderList.size(); id++) {
+		ColliderComponent *collider = mColliderList[id];
+
+		if (isActive(*collider)) {
+			mBoxList[id] = shiftBox(collider->calcBox(), -mOriginPosition.first, -mOriginPosition.second);
+			mCollisionGrid.insert(id, mBoxList[id].left, mBoxList[id].right);
+		} else {
+			//Nothing to do. Inactive colliders can't be found.
+		}
+	}
+}
+
+/**
+ * @brief fill the contact manifold of a dynamic collider.
+ *
+ * Solids are swept along the movement since the last step, so a long step
+ * can't carry the collider through them. Other colliders are tested where
+ * they are now. Triggers only list the overlaps.
+ *
+ * @param id position of the collider on mColliderList.
+ *
+ * @return "void".
+*/
+void PhysicsWorld::findContacts(unsigned int id) {
+	ColliderComponent &body = *mColliderList[id];
+	ContactManifold &manifold = body.mContactManifold;
+	const CollisionBox &originBox = mBoxList[id];
+	CollisionBox box = shiftBox(originBox, mOriginPosition.first, mOriginPosition.second);
+	double moveX = 0.0;
+	double moveY = 0.0;
+
+	if (body.mHasLastBox) {
+		moveX = originBox.left - body.mLastBox.left;
+		moveY = originBox.top - body.mLastBox.top;
+	} else {
+		//Nothing to do. The collider hasn't moved yet.
+	}
+
+	manifold.clear();
+	body.mFoundList.clear();
+
+	// Everything the collider went over, and the distance at which walls are felt.
+	CollisionBox sweptBox = {std::min(originBox.left, originBox.left - moveX) - manifold.getWallInsetX(),
+	                         std::min(originBox.top, originBox.top - moveY),
+	                         std::max(originBox.right, originBox.right - moveX) + manifold.getWallInsetX(),
+	                         std::max(originBox.bottom, originBox.bottom - moveY)};
+
+	mCollisionWorld.findOverlaps(sweptBox, mCandidateList);
+
+	for (auto eachCandidate : mCandidateList) {
+		ColliderComponent &solid = *mSolidList[eachCandidate];
+		CollisionBox solidBox = shiftBox(mCollisionWorld.getBox(eachCandidate), mOriginPosition.first, mOriginPosition.second);
+		bool touches = false;
+
+		if (!body.accepts(solid) || !isActive(solid)) {
+			//Nothing to do. The collider doesn't see this solid.
+		} else if (body.mTrigger) {
+			touches = manifold.addTrigger(box, solidBox, solid.gameObject);
+		} else {
+			touches = manifold.addSweptSolid(box, moveX, moveY, solidBox, solid.gameObject);
+		}
+
+		if (touches) {
+			body.mFoundList.push_back(&solid);
+		} else {
+			//Nothing to do.
+		}
+	}
+
+	mCollisionGrid.query(sweptBox.left, sweptBox.right, mCandidateList);
+
+	for (auto eachCandidate : mCandidateList) {
+		ColliderComponent &other = *mColliderList[eachCandidate];
+		CollisionBox otherBox = shiftBox(mBoxList[eachCandidate], mOriginPosition.first, mOriginPosition.second);
+		bool touches = false;
+
+		if (eachCandidate == id || !body.accepts(other)) {
+			//Nothing to do. The collider doesn't see this one.
+		} else if (body.mTrigger || other.mTrigger) {
+			touches = manifold.addTrigger(box, otherBox, other.gameObject);
+		} else {
+			touches = manifold.addSolid(box, otherBox, other.gameObject);
+		}
+
+		if (touches) {
+			body.mFoundList.push_back(&other);
+		} else {
+			//Nothing to do.
+		}
+	}
+
+	body.mLastBox = originBox;
+	body.mHasLastBox = true;
+}
+
+/**
+ * @brief queue the events of the contacts of a dynamic collider.
+ *
+ * Compares the colliders touched on this step with the ones touched on
+ * the last. Static colliders are told too, when they see the dynamic one,
+ * since they don't look for contacts themselves. Triggers have no STAY
+ * events: an overlap costs nothing while it lasts.
+ *
+ * @param collider dynamic collider whose contacts were found.
+ *
+ * @return "void".
+*/
+void PhysicsWorld::notifyContacts(ColliderComponent &collider) {
+	for (auto eachFound : collider.mFoundList) {
+		auto position = std::find(collider.mTouchingList.begin(), collider.mTouchingList.end(), eachFound);
+
+		if (position == collider.mTouchingList.end()) {
+			queueEvent(CollisionEvent::ENTER, collider, *eachFound);
+		} else if (!collider.mTrigger && !eachFound->mTrigger) {
+			queueEvent(CollisionEvent::STAY, collider, *eachFound);
+		} else {
+			//Nothing to do. The trigger was already entered.
+		}
+	}
+
+	for (auto eachTouching : collider.mTouchingList) {
+		auto position = std::find(collider.mFoundList.begin(), collider.mFoundList.end(), eachTouching);
+
+		if (position == collider.mFoundList.end()) {
+			queueEvent(CollisionEvent::EXIT, collider, *eachTouching);
+		} else {
+			//Nothing to do. They're still touching.
+		}
+	}
+
+	collider.mTouchingList.swap(collider.mFoundList);
+}
+
+/**
+ * @brief queue an event for a dynamic collider and, when it sees it, for
+ * the static collider it touched.
+ *
+ * @param event whether the colliders started, kept or stopped touching.
+ * @param receiver dynamic collider that found the contact.
+ * @param other collider touched by the receiver.
+ *
+ * @return "void".
+*/
+void PhysicsWorld::queueEvent(CollisionEvent event, ColliderComponent &receiver, ColliderComponent &other) {
+	CollisionEventEntry entry = {event, &receiver, &other};
+	mEventList.push_back(entry);
+
+	if (other.mColliderType == ColliderType::STATIC && other.accepts(receiver)) {
+		CollisionEventEntry otherEntry = {event, &other, &receiver};
+		mEventList.push_back(otherEntry);
+	} else {
+		//Nothing to do. Dynamic colliders are told by their own contacts.
+	}
+}
+
+/**
+ * @brief deliver the events queued on this step.
+ *
+ * Handlers may remove colliders (their entries are skipped) or clear the
+ * world (the delivery stops).
+ *
+ * @return "void".
+*/
+void PhysicsWorld::deliverEvents() {
+	for (unsigned int id = 0; id < mEventList.size(); id++) {
+		CollisionEventEntry entry = mEventList[id];
+
+		if (entry.receiver != NULL) {
+			entry.receiver->gameObject->onCollision(entry.event, *entry.other);
+		} else {
+			//Nothing to do. The collider left the world.
+		}
+	}
+
+	mEventList.clear();
+}
+
+/**
+ * @brief check if a collider takes part in the step.
+ *
+ * @param collider collider to be checked.
+ *
+ * @return true when both the collider and its game object are enabled,
+ * and the collider has a box.
+*/
+bool PhysicsWorld::isActive(ColliderComponent &collider) {
+	return collider.isEnabled() && collider.gameObject->mObjectState == ObjectState::ENABLED && collider.hasBox();
+}
+
+/**
+ * @brief move a box.
+ *
+ * @return the box moved by shiftX and shiftY.
+*/
+CollisionBox PhysicsWorld::shiftBox(const CollisionBox &box, double shiftX, double shiftY) {
+	CollisionBox shiftedBox = {box.left + shiftX, box.top + shiftY, box.right + shiftX, box.bottom + shiftY};
+	return shiftedBox;
+}
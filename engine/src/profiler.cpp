@@ -0,0 +1,126 @@
+/**
+ * @file profiler.cpp
+ * @brief Purpose: Contains the methods of the Profiler class.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "profiler.hpp"
+#include "log.h"
+#include <fstream>
+#include <iomanip>
+
+#ifndef NPROFILE
+using namespace engine;
+
+Profiler Profiler::instance; // Used to initialize in fact the static instance of profiler.
+
+const unsigned int PROFILER_CAPACITY = 65536; // Events kept, a few seconds of a busy scene.
+const double MICROSECONDS_PER_SECOND = 1000000.0;
+
+/**
+ * @brief Default constructor for the Profiler.
+ *
+ * Allocates the whole ring buffer upfront.
+ *
+ * @return "void".
+*/
+Profiler::Profiler() {
+	mEvents.resize(PROFILER_CAPACITY);
+	mNextEvent = 0;
+	enabled = true;
+}
+
+Profiler::~Profiler() {}
+
+/**
+ * @brief forget all the recorded events.
+ *
+ * @return "void".
+*/
+void Profiler::clear() {
+	mNextEvent = 0;
+}
+
+/**
+ * @brief write the recorded events to the path set by "setOutputPath".
+ *
+ * @return false when there's no output path or the file can't be written.
+*/
+bool Profiler::exportTrace() {
+	if(mOutputPath == "") {
+		return false;
+	} else {
+		return exportTrace(mOutputPath);
+	}
+}
+
+/**
+ * @brief write the recorded events as a chrome://tracing JSON file.
+ *
+ * Events are written from the oldest kept to the newest, as complete
+ * ("X") events with times in microseconds.
+ *
+ * @param tracePath path of the JSON file.
+ *
+ * @return false when the file can't be written.
+*/
+bool Profiler::exportTrace(std::string tracePath) {
+	ASSERT(tracePath != "", "The trace path can't be blank.");
+
+	std::ofstream traceFile(tracePath.c_str());
+
+	if(traceFile.is_open()) {
+		//Nothing to do. The file can be written.
+	} else {
+		WARN("Couldn't open trace file " << tracePath);
+		return false;
+	}
+
+	unsigned long totalEvents = mNextEvent;
+	unsigned long firstEvent = 0;
+
+	if(totalEvents > mEvents.size()) {
+		firstEvent = totalEvents - mEvents.size();
+	} else {
+		//Nothing to do. The buffer hasn't wrapped yet.
+	}
+
+	double counterToMicroseconds = MICROSECONDS_PER_SECOND / SDL_GetPerformanceFrequency();
+	Uint64 firstStart = SDL_GetPerformanceCounter(); // Times are written relative to it.
+
+	// Events are recorded when they end, so the oldest kept isn't the first to start.
+	for(unsigned long i = firstEvent; i < totalEvents; i++) {
+		if(mEvents[i % mEvents.size()].start < firstStart) {
+			firstStart = mEvents[i % mEvents.size()].start;
+		} else {
+			//Nothing to do. It started later.
+		}
+	}
+
+	traceFile << std::fixed << std::setprecision(3);
+	traceFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	for(unsigned long i = firstEvent; i < totalEvents; i++) {
+		const ProfileEvent &event = mEvents[i % mEvents.size()];
+
+		if(i != firstEvent) {
+			traceFile << ",";
+		} else {
+			//Nothing to do. The first event has no separator.
+		}
+
+		traceFile << "\n{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.threadId
+		          << ",\"ts\":" << (event.start - firstStart) * counterToMicroseconds
+		          << ",\"dur\":" << (event.end - event.start) * counterToMicroseconds << "}";
+	}
+
+	traceFile << "\n]}\n";
+
+	INFO("Exported " << totalEvents - firstEvent << " profiler events to " << tracePath);
+
+	return true;
+}
+#endif
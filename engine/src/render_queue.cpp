@@ -0,0 +1,161 @@
+/**
+ * @file render_queue.cpp
+ * @brief Purpose: Contains the methods of the RenderQueue class.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "render_queue.hpp"
+#include "log.h"
+#include <algorithm>
+
+using namespace engine;
+
+const unsigned int INITIAL_COMMANDS = 256; // Enough for a level without growing.
+
+/**
+ * @brief compare two commands by layer, then by order, then by sequence.
+ *
+ * @return true when the first must be drawn before the second.
+*/
+static bool isLowerLayer(const RenderCommand &first, const RenderCommand &second) {
+	if(first.layer != second.layer) {
+		return first.layer < second.layer;
+	} else if(first.order != second.order) {
+		return first.order < second.order;
+	} else {
+		return first.sequence < second.sequence;
+	}
+}
+
+/**
+ * @brief check if a rectangle is entirely outside another.
+ *
+ * @return true when they don't overlap.
+*/
+static bool isOutside(const SDL_Rect &rect, const SDL_Rect &viewport) {
+	return rect.x >= viewport.x + viewport.w || rect.x + rect.w <= viewport.x ||
+	       rect.y >= viewport.y + viewport.h || rect.y + rect.h <= viewport.y;
+}
+
+/**
+ * @brief Default constructor for the RenderQueue.
+ *
+ * @return "void".
+*/
+RenderQueue::RenderQueue() {
+	mCommandLists[0].reserve(INITIAL_COMMANDS);
+	mCommandLists[1].reserve(INITIAL_COMMANDS);
+	mCulledCounts[0] = 0;
+	mCulledCounts[1] = 0;
+	mBackList = 0;
+	mViewport = {0, 0, 0, 0};
+}
+
+RenderQueue::~RenderQueue() {}
+
+/**
+ * @brief record a texture copy on the back list.
+ *
+ * Copies entirely outside the viewport are only counted.
+ *
+ * @param texture texture to be copied.
+ * @param source part of the texture to copy.
+ * @param destination where it goes on the canvas, NULL for the whole canvas.
+ * @param layer lower layers are drawn first.
+ * @param order lower orders are drawn first on the same layer.
+ *
+ * @return "void".
+*/
+void RenderQueue::push(SDL_Texture *texture, const SDL_Rect &source,
+                       const SDL_Rect *destination, int layer, unsigned int order) {
+	if(destination != NULL && mViewport.w > 0 && isOutside(*destination, mViewport)) {
+		mCulledCounts[mBackList]++;
+		return;
+	} else {
+		//Nothing to do. The copy may be visible.
+	}
+
+	RenderCommand command;
+
+	command.texture = texture;
+	command.source = source;
+	command.wholeCanvas = (destination == NULL);
+	command.layer = layer;
+	command.order = order;
+	command.sequence = mCommandLists[mBackList].size();
+
+	if(destination != NULL) {
+		command.destination = *destination;
+	} else {
+		command.destination = {0, 0, 0, 0};
+	}
+
+	mCommandLists[mBackList].push_back(command);
+}
+
+/**
+ * @brief make the recorded list the one to submit.
+ *
+ * The old front list is cleared and becomes the new back list.
+ *
+ * @return "void".
+*/
+void RenderQueue::swap() {
+	mBackList = 1 - mBackList;
+	mCommandLists[mBackList].clear();
+	mCulledCounts[mBackList] = 0;
+}
+
+/**
+ * @brief copy the front list to the canvas.
+ *
+ * Commands with the same layer and order keep the order they were recorded:
+ * their sequence breaks the tie, so the sort doesn't need stable_sort and
+ * its temporary buffer.
+ *
+ * @param canvas renderer that receives the copies.
+ *
+ * @return "void".
+*/
+void RenderQueue::submit(SDL_Renderer *canvas) {
+	ASSERT(canvas != NULL, "The canvas can't be null.");
+
+	std::vector<RenderCommand> &frontList = mCommandLists[1 - mBackList];
+
+	std::sort(frontList.begin(), frontList.end(), isLowerLayer);
+
+	for(auto &command : frontList) {
+		SDL_RenderCopy(
+			canvas,
+			command.texture,
+			&command.source,
+			command.wholeCanvas ? NULL : &command.destination
+		);
+	}
+}
+
+/**
+ * @brief drop every recorded command.
+ *
+ * @return "void".
+*/
+void RenderQueue::clear() {
+	mCommandLists[0].clear();
+	mCommandLists[1].clear();
+	mCulledCounts[0] = 0;
+	mCulledCounts[1] = 0;
+}
+
+/**
+ * @brief set the visible part of the canvas.
+ *
+ * @param viewport visible rectangle, an empty one turns culling off.
+ *
+ * @return "void".
+*/
+void RenderQueue::setViewport(const SDL_Rect &viewport) {
+	mViewport = viewport;
+}
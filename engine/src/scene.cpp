@@ -8,86 +8,198 @@
  * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
  */
 #include "scene.hpp"
+#include "game.hpp"
+#include "profiler.hpp"
 #include <ctime>
 #include <fstream>
 #include <iostream>
 
 using namespace engine;
 
-Scene::Scene() {}
+// Bytes of each chunk of the scene arena, a level fits in one.
+const std::size_t SCENE_ARENA_CHUNK_SIZE = 128 * 1024;
+
+Scene::Scene() :
+	mArena(SCENE_ARENA_CHUNK_SIZE) {}
 
 /*
  *@brief Contructor for the scene
  *
  * initializes the SceneName attribute
  */
-Scene::Scene(std::string sceneName) {
+Scene::Scene(std::string sceneName) :
+	mArena(SCENE_ARENA_CHUNK_SIZE) {
 	DEBUG("Creating Scene " << sceneName);
 	this->sceneName = sceneName;
 }
 
 /*
- *@brief Method to initialize the gameObjectMap
+ *@brief Method to initialize the game objects
  *
- *Initializes every key in the gameObjectMap
+ *Initializes every game object of the scene
  */
 void Scene::init(){
 	DEBUG("Init Scene " << sceneName);
-	for (auto eachKey : mKeyList) {
-		gameObjectMap[eachKey]->init();
+	for (GameObjectHandle handle = 0; handle < mGameObjectList.size(); handle++) {
+		if (mGameObjectList[handle] != NULL) {
+			mGameObjectList[handle]->init();
+		} else {
+			//Nothing to do. The game object was removed.
+		}
 	}
 }
 
 /*
  *@brief Method to shutdown all game objects
  *
- *passes every object in the gameObjectMap to the shutdown method
+ *passes every object of the scene to the shutdown method, then releases
+ *the ones built on the scene arena all at once
  */
 void Scene::shutdown() {
 	DEBUG("Shutdown Scene " << sceneName)
-	for (auto eachKey : mKeyList) {
-		gameObjectMap[eachKey]->shutdown();
+	for (GameObjectHandle handle = 0; handle < mGameObjectList.size(); handle++) {
+		if (mGameObjectList[handle] != NULL) {
+			mGameObjectList[handle]->shutdown();
+		} else {
+			//Nothing to do. The game object was removed.
+		}
 	}
 
+	// Shut down objects can't be restored, the scene must be recreated.
+	mSnapshot.clear();
 	deleteKeyList();
+	gameObjectMap.clear();
+	mArena.reset();
 }
 
 /*
  *@brief Method to delete the key list
+ *
+ *Takes every game object out of the scene. Their handles become invalid.
  */
 void Scene::deleteKeyList() {
 	DEBUG("Deleting key list");
-	mKeyList.erase(mKeyList.begin(), mKeyList.end());
+	mGameObjectList.clear();
 }
 
 /*
  *@brief Method to draw scene on screen
  *
- *Passes every gameObjectin the gameObjectMap to the draw() method
+ *Every drawn component of the scene is on a pool since its init, the draw
+ *systems go through them instead of the game objects.
  */
 void Scene::draw() {
-	for (auto eachKey : mKeyList) {
-		if(gameObjectMap[eachKey]->mObjectState == ObjectState::ENABLED) {
-			gameObjectMap[eachKey]->draw();
+	PROFILE_SCOPE("Scene::draw");
+	Game::instance.getComponentSystems().draw();
+}
+
+/*
+ *@brief Methos to update the code of the scene
+ *
+ *Passes every enabled element of the scene to the updateCode() method.
+ *Indexes are used instead of iterators, so game objects added while
+ *updating don't invalidate the loop. The animations and audios are
+ *updated by their systems once the code ran.
+ */
+void Scene::updateCode(){
+	PROFILE_SCOPE("Scene::updateCode");
+
+	for(GameObjectHandle handle = 0; handle < mGameObjectList.size(); handle++){
+		GameObject *gameObject = mGameObjectList[handle];
+
+		if (gameObject != NULL && gameObject->mObjectState == ObjectState::ENABLED){
+			gameObject->updateCode();
 		} else {
 			//Nothing to do
 		}
 	}
+
+	Game::instance.getComponentSystems().update();
 }
 
 /*
- *@brief Methos to update the code of the scene
+ *@brief Method to keep the positions of the last simulation step
  *
- *Passes every element of the gameObjectMap to the updateCode() method.
+ *Called before each fixed step so draw() can interpolate between two states.
  */
-void Scene::updateCode(){
-	for(auto eachKey : mKeyList){
-		if (gameObjectMap[eachKey]->mObjectState == ObjectState::ENABLED){
-			gameObjectMap[eachKey]->updateCode();
+void Scene::storePreviousPositions(){
+	for(auto gameObject : mGameObjectList){
+		if(gameObject != NULL){
+			gameObject->storePreviousPosition();
 		} else {
-			//Nothing to do
+			//Nothing to do. The game object was removed.
+		}
+	}
+}
+
+/*
+ *@brief Method to list the assets of the scene
+ *
+ *Collects the assets of every object of the scene, so the scene can be
+ *preloaded before its init. Scenes already shut down list nothing, since
+ *their assets stay loaded.
+ */
+void Scene::collectAssets(AssetList &assetList){
+	for(auto gameObject : mGameObjectList){
+		if(gameObject != NULL){
+			gameObject->collectAssets(assetList);
+		} else {
+			//Nothing to do. The game object was removed.
+		}
+	}
+}
+
+/*
+ *@brief Method to save the state of the scene
+ *
+ *Writes the state of every game object of the scene. Called right after
+ *init, so restoring it restarts the scene without recreating its objects.
+ *Scenes must set snapshotEnabled, and their objects must save every state
+ *they change while running.
+ */
+void Scene::saveSnapshot(){
+	if(snapshotEnabled){
+		PROFILE_SCOPE("Scene::saveSnapshot");
+		mSnapshot.clear();
+		mSnapshot.write(mGameObjectList.size());
+
+		for(auto gameObject : mGameObjectList){
+			if(gameObject != NULL){
+				gameObject->saveState(mSnapshot);
+			} else {
+				//Nothing to do. The game object was removed.
+			}
+		}
+
+		DEBUG("Saved snapshot of scene " << sceneName << " (" << mSnapshot.getSize() << " bytes).");
+	} else {
+		//Nothing to do. The scene restarts with "restart".
+	}
+}
+
+/*
+ *@brief Method to restore the state saved by saveSnapshot
+ *
+ *Puts every game object back as it was right after init, without allocating.
+ */
+void Scene::restoreSnapshot(){
+	PROFILE_SCOPE("Scene::restoreSnapshot");
+	ASSERT(hasSnapshot(), "The scene must have a snapshot to restore.");
+
+	std::vector<GameObject *>::size_type objectCount = 0;
+	mSnapshot.rewind();
+	mSnapshot.read(objectCount);
+	ASSERT(objectCount == mGameObjectList.size(), "The scene objects changed since the snapshot.");
+
+	for(auto gameObject : mGameObjectList){
+		if(gameObject != NULL){
+			gameObject->loadState(mSnapshot);
+		} else {
+			//Nothing to do. The game object was removed.
 		}
 	}
+
+	ASSERT(mSnapshot.isAtEnd(), "The whole snapshot must be read.");
 }
 
 /*
@@ -100,9 +212,11 @@ void Scene::restart(){}
 /*
  *@brief Method to add a new game object
  *
- *adds a new game object in the gameObjectMap
+ *adds a new game object at the end of the scene, and in the gameObjectMap
+ *
+ *@return the handle of the game object on the scene.
  */
-void Scene::addGameObject(GameObject &gameObject){
+GameObjectHandle Scene::addGameObject(GameObject &gameObject){
 
 	auto gameObjectName = gameObject.mName;
 	DEBUG("Adding game object" << gameObjectName);
@@ -114,7 +228,46 @@ void Scene::addGameObject(GameObject &gameObject){
 	}
 
 	gameObjectMap[gameObjectName] = &gameObject;
-	mKeyList.push_back(gameObjectName);
+	gameObject.mDrawOrder = mGameObjectList.size();
+	mGameObjectList.push_back(&gameObject);
+
+	return mGameObjectList.size() - 1;
+}
+
+/*
+ *@brief Method to reserve slots for game objects
+ *
+ *Adds empty slots at the end of the scene, for game objects placed later
+ *with placeGameObject. They're drawn and updated in the order of their
+ *slots, like the others.
+ *
+ *@return the handle of the first slot.
+ */
+GameObjectHandle Scene::reserveGameObjects(unsigned int count){
+	GameObjectHandle firstHandle = mGameObjectList.size();
+	mGameObjectList.resize(mGameObjectList.size() + count, NULL);
+
+	return firstHandle;
+}
+
+/*
+ *@brief Method to place a game object on an empty slot
+ *
+ *The slot is emptied again by removeGameObject.
+ */
+void Scene::placeGameObject(GameObjectHandle handle, GameObject &gameObject){
+	ASSERT(handle < mGameObjectList.size(), "Invalid game object handle.");
+	ASSERT(mGameObjectList[handle] == NULL, "The slot already has a game object.");
+
+	if (gameObjectMap.find(gameObject.mName) != gameObjectMap.end()){
+		ERROR("Game object already exists!");
+	} else {
+		//Nothing to do
+	}
+
+	gameObjectMap[gameObject.mName] = &gameObject;
+	gameObject.mDrawOrder = handle;
+	mGameObjectList[handle] = &gameObject;
 }
 
 /*
@@ -134,6 +287,18 @@ GameObject & Scene::getGameObject(std::string &gameObjectName){
 	return *gameObjectMap[gameObjectName];
 }
 
+/*
+ *@brief Method to retrieve a gameObject by its handle
+ *
+ *returns a gameObject without looking up its name
+ */
+GameObject & Scene::getGameObject(GameObjectHandle handle){
+	ASSERT(handle < mGameObjectList.size(), "Invalid game object handle.");
+	ASSERT(mGameObjectList[handle] != NULL, "The game object was removed.");
+
+	return *mGameObjectList[handle];
+}
+
 /*
  *@method to remove a gameObject
  *
@@ -141,15 +306,40 @@ GameObject & Scene::getGameObject(std::string &gameObjectName){
  */
 void Scene::removeGameObject(std::string &gameObjectName){
 	DEBUG("Remove game object" << gameObjectName);
-	if (gameObjectMap.find(gameObjectName) == gameObjectMap.end()){
+	auto gameObjectPosition = gameObjectMap.find(gameObjectName);
+
+	if (gameObjectPosition == gameObjectMap.end()){
 		errorLog(ErrorTypeScene::NULL_POINTER, "Scene::removeGameObject");
 		ERROR("Game object doesn't exist!");
+		return;
 	} else {
 		//Nothing to do
 	}
 
-	gameObjectMap.erase(gameObjectName);
-	mKeyList.remove(gameObjectName);
+	for(GameObjectHandle handle = 0; handle < mGameObjectList.size(); handle++){
+		if(mGameObjectList[handle] == gameObjectPosition->second){
+			removeGameObject(handle);
+			return;
+		} else {
+			//Nothing to do. Keep looking.
+		}
+	}
+
+	// Not on the scene anymore, only on the map.
+	gameObjectMap.erase(gameObjectPosition);
+}
+
+/*
+ *@method to remove a gameObject by its handle
+ *
+ *Leaves its slot empty, so the handles of the other game objects stay valid.
+ */
+void Scene::removeGameObject(GameObjectHandle handle){
+	ASSERT(handle < mGameObjectList.size(), "Invalid game object handle.");
+	ASSERT(mGameObjectList[handle] != NULL, "The game object was already removed.");
+
+	gameObjectMap.erase(mGameObjectList[handle]->mName);
+	mGameObjectList[handle] = NULL;
 }
 
 
@@ -16,6 +16,7 @@ const int FIRST_RENDERING_DRIVER = -1;
 const int AUDIO_CHANNELS = 2;
 const int AUDIO_CHUNKSIZE = 2048;
 const int AUDIO_RESULT_NULL = 0;
+const int OFFSCREEN_DEPTH = 32;
 
 
 /**
@@ -23,7 +24,12 @@ const int AUDIO_RESULT_NULL = 0;
 *
 * @return "void".
 */
-SDL::SDL(){}
+SDL::SDL(){
+	window = NULL;
+	canvas = NULL;
+	offscreenSurface = NULL;
+	headless = false;
+}
 
 /**
  * @brief initialize all SDL.
@@ -34,9 +40,19 @@ SDL::SDL(){}
 */
 void SDL::initSDL() {
 	INFO("Initializing SDL.");
-	INFO("Initializing Audio and Video.");
 
-	if(SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) == 0) {
+	Uint32 subsystems = SDL_INIT_VIDEO | SDL_INIT_AUDIO;
+
+	if(headless) {
+		INFO("Initializing Audio and Events (headless).");
+		// The dummy driver accepts and discards audio, so the mixer works without a sound card.
+		SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+		subsystems = SDL_INIT_EVENTS | SDL_INIT_AUDIO;
+	} else {
+		INFO("Initializing Audio and Video.");
+	}
+
+	if(SDL_Init(subsystems) == 0) {
 		//Nothing to do. It was initialized correctly.
 	} else {
 		ERROR("SDL Video or SDL Audio couldn't be started.");
@@ -67,6 +83,13 @@ void SDL::initSDL() {
  * @return "void".
 */
 void SDL::createWindow() {
+	if(headless) {
+		createOffscreenCanvas();
+		return;
+	} else {
+		//Nothing to do. A window is created below.
+	}
+
 	INFO("Creating Window.");
 	window = SDL_CreateWindow (
 		gameName.c_str(),      // Game window title.
@@ -92,6 +115,14 @@ void SDL::createWindow() {
 		SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC  // Flag. The renderer will use hardware acceleration
 	);
 
+	if(canvas == NULL) {
+		// Machines without a GPU driver still can run on the software renderer.
+		WARN("Couldn't create accelerated renderer, using software: " << SDL_GetError());
+		canvas = SDL_CreateRenderer(window, FIRST_RENDERING_DRIVER, SDL_RENDERER_SOFTWARE);
+	} else {
+		//Nothing to do. It was created correctly.
+	}
+
 	ASSERT(canvas != NULL, "Couldn't create renderer (Canvas).");
 
 	//Set window color when redrawing.
@@ -103,6 +134,38 @@ void SDL::createWindow() {
 		0xff);  // Opacity (alpha)
 	}
 
+	/**
+	 * @brief creating an offscreen Canvas.
+	 *
+	 * Used instead of the window when running headless. The software renderer
+	 * draws into a surface in memory, so textures can still be created and
+	 * drawn without a display or a GPU.
+	 *
+	 * @return "void".
+	*/
+	void SDL::createOffscreenCanvas() {
+		INFO("Creating offscreen canvas.");
+		offscreenSurface = SDL_CreateRGBSurfaceWithFormat(
+			0,                        // Flags, unused.
+			windowWidth,              // Surface width.
+			windowHeight,             // Surface height.
+			OFFSCREEN_DEPTH,          // Bits per pixel.
+			SDL_PIXELFORMAT_RGBA8888  // Pixel format.
+		);
+
+		if(offscreenSurface != NULL) {
+			//Nothing to do. It was created correctly.
+		} else {
+			ERROR("Couldn't create offscreen surface: " << SDL_GetError());
+		}
+
+		canvas = SDL_CreateSoftwareRenderer(offscreenSurface);
+
+		ASSERT(canvas != NULL, "Couldn't create software renderer (Canvas).");
+
+		SDL_SetRenderDrawColor(canvas, 0xff, 0xff, 0xff, 0xff);
+	}
+
 	/**
 	 * @brief terminating SDL.
 	 *
@@ -116,9 +179,21 @@ void SDL::createWindow() {
 		SDL_DestroyRenderer(canvas);
 		canvas = NULL;
 
-		DEBUG("Destroying Window");
-		SDL_DestroyWindow(window);
-		window = NULL;
+		if(window != NULL) {
+			DEBUG("Destroying Window");
+			SDL_DestroyWindow(window);
+			window = NULL;
+		} else {
+			//Nothing to do. Headless runs have no window.
+		}
+
+		if(offscreenSurface != NULL) {
+			DEBUG("Freeing offscreen surface");
+			SDL_FreeSurface(offscreenSurface);
+			offscreenSurface = NULL;
+		} else {
+			//Nothing to do. There is no offscreen canvas.
+		}
 
 		DEBUG("Quitting IMG.");
 		IMG_Quit();
@@ -149,3 +224,55 @@ void SDL::createWindow() {
 		this->windowWidth = windowWidth;
 		this->windowHeight = windowHeight;
 	}
+
+	/**
+	 * @brief choose to run without window, GPU renderer or audio device.
+	 *
+	 * @param headless true to draw into an offscreen software canvas and use a dummy audio driver.
+	 *
+	 * @return "void".
+	*/
+	void SDL::setHeadless(bool headless) {
+		this->headless = headless;
+	}
+
+	/**
+	 * @brief check if the canvas presents with vsync.
+	 *
+	 * The driver may ignore the vsync request, so the renderer is asked.
+	 *
+	 * @return true when "SDL_RenderPresent" waits for the display.
+	*/
+	bool SDL::hasVsync() {
+		SDL_RendererInfo rendererInfo;
+
+		if(canvas == NULL || SDL_GetRendererInfo(canvas, &rendererInfo) != 0) {
+			return false;
+		} else {
+			return (rendererInfo.flags & SDL_RENDERER_PRESENTVSYNC) != 0;
+		}
+	}
+
+	/**
+	 * @brief refresh rate of the display showing the window.
+	 *
+	 * @return the refresh rate (Hz), zero when unknown or headless.
+	*/
+	int SDL::getRefreshRate() {
+		SDL_DisplayMode displayMode;
+
+		if(window == NULL) {
+			return 0;
+		} else {
+			//Nothing to do. The window is on a display.
+		}
+
+		int displayIndex = SDL_GetWindowDisplayIndex(window);
+
+		if(displayIndex < 0 || SDL_GetCurrentDisplayMode(displayIndex, &displayMode) != 0) {
+			WARN("Couldn't get the display mode: " << SDL_GetError());
+			return 0;
+		} else {
+			return displayMode.refresh_rate;
+		}
+	}
@@ -24,10 +24,8 @@ Sprite::Sprite(
 	unsigned int spriteX, unsigned int spriteY
 ) {
 	DEBUG("Calling Sprite::Sprite");
-	ASSERT(spriteWidth < 0, "Sprite::Sprite, sprite width can't be less than zero.");
-	ASSERT(spriteHeight > 0, "Sprite::Sprite, sprite height can't be less than zero.");
-	ASSERT(spriteX > 0, "Sprite::Sprite, sprite x coordinate can't be less than zero.");
-	ASSERT(spriteY > 0, "Sprite::Sprite, sprite y coordinate can't be less than zero.");
+	ASSERT(spriteWidth > 0, "Sprite::Sprite, sprite width must be bigger than zero.");
+	ASSERT(spriteHeight > 0, "Sprite::Sprite, sprite height must be bigger than zero.");
 	this->spriteWidth = spriteWidth;
 	this->spriteHeight = spriteHeight;
 	this->spriteX = spriteX;
@@ -0,0 +1,69 @@
+/**
+ * @file state_buffer.cpp
+ * @brief Purpose: Contains the methods of the StateBuffer class.
+ *
+ * GLP v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "state_buffer.hpp"
+
+using namespace engine;
+
+/**
+ * @brief Default constructor for the StateBuffer.
+ *
+ * @return "void".
+*/
+StateBuffer::StateBuffer() {
+	mReadPosition = 0;
+}
+
+/**
+ * @brief drop the written state.
+ *
+ * The memory is kept, so writing the same state again doesn't allocate.
+ *
+ * @return "void".
+*/
+void StateBuffer::clear() {
+	mData.clear();
+	mReadPosition = 0;
+}
+
+/**
+ * @brief read again from the first value.
+ *
+ * @return "void".
+*/
+void StateBuffer::rewind() {
+	mReadPosition = 0;
+}
+
+/**
+ * @brief check if any state was written.
+ *
+ * @return true when the buffer is empty.
+*/
+bool StateBuffer::isEmpty() {
+	return mData.empty();
+}
+
+/**
+ * @brief check if every value was read.
+ *
+ * @return true when there's nothing left to read.
+*/
+bool StateBuffer::isAtEnd() {
+	return mReadPosition == mData.size();
+}
+
+/**
+ * @brief access the size of the written state.
+ *
+ * @return the size of the buffer (bytes).
+*/
+unsigned long StateBuffer::getSize() {
+	return mData.size();
+}
@@ -15,6 +15,9 @@
 
 using namespace engine;
 
+const Uint64 NANOSECONDS_PER_SECOND = 1000000000;
+const double NANOSECONDS_PER_MILLISECOND = 1000000.0;
+
 /*
  *@brief Constructor for the timer.
  *
@@ -31,39 +34,81 @@ Timer::~Timer() {}
 /*
  *@brief Method to do a timer step
  *
- *updated the total elapsed time with present time
+ * Stores the time passed since the previous step as the delta time, so it
+ * covers the whole last frame, waits included.
  */
 void Timer::step() {
-	elapsedTicks = SDL_GetTicks();
+	Uint64 currentCounter = SDL_GetPerformanceCounter();
+	Uint64 frequency = SDL_GetPerformanceFrequency();
+
+	deltaTime = (currentCounter - stepCounter) * 1000.0 / frequency;
+	stepCounter = currentCounter;
 }
 
 
 /*
  *@brief Method to reset the timer
  *
- * Reset startTicks and sets all other attributes to zero
+ * Starts counting from now and sets the delta time to zero
  */
 void Timer::Reset() {
   DEBUG("Resetting Timer");
-	startTicks = SDL_GetTicks();
-	elapsedTicks = 0.0f;
-	deltaTime = 0.0f;
+	stepCounter = SDL_GetPerformanceCounter();
+	deltaTime = 0.0;
 }
 
 /*
- *@brief Method to calculate elapsed time since last step
+ *@brief Method to get the time passed since the last step
+ *
+ * Doesn't change the delta time.
  *
- * Calculates difference from present tick to total elapsed ticks
+ *@return the elapsed time (miliseconds)
  */
-void Timer::DeltaTime() {
-	deltaTime = SDL_GetTicks() - elapsedTicks;
+double Timer::getElapsedTime() {
+	Uint64 elapsedCounter = SDL_GetPerformanceCounter() - stepCounter;
+
+	return elapsedCounter * 1000.0 / SDL_GetPerformanceFrequency();
 }
 
 /*
- *@brief Method to get elapsed time since last step
+ *@brief Method to get the time between the last two steps
  *
- *@return the elapsed time
+ *@return the delta time (miliseconds)
  */
-float Timer::getDeltaTime() {
+double Timer::getDeltaTime() {
 	return deltaTime;
 }
+
+/*
+ *@brief Method to override the elapsed time since last step
+ *
+ * Used by the fixed timestep loop so game code reads the step duration.
+ */
+void Timer::setDeltaTime(double deltaTime) {
+	this->deltaTime = deltaTime;
+}
+
+/*
+ *@brief Method to read the high resolution clock
+ *
+ * The counter is split in whole seconds and remainder so the conversion
+ * doesn't overflow on machines with a fast counter.
+ *
+ *@return the current time (nanoseconds) from an arbitrary start
+ */
+Uint64 Timer::getNanoseconds() {
+	Uint64 counter = SDL_GetPerformanceCounter();
+	Uint64 frequency = SDL_GetPerformanceFrequency();
+
+	return (counter / frequency) * NANOSECONDS_PER_SECOND +
+	       (counter % frequency) * NANOSECONDS_PER_SECOND / frequency;
+}
+
+/*
+ *@brief Method to read the high resolution clock
+ *
+ *@return the current time (miliseconds) from an arbitrary start
+ */
+double Timer::getMilliseconds() {
+	return getNanoseconds() / NANOSECONDS_PER_MILLISECOND;
+}
@@ -20,7 +20,12 @@ namespace global {
 	const int WINDOWN_WIDTH = 800;   // Pixels.
 	const int WINDOWN_HEIGHT = 494;  // Pixels
 	const int FRAME_RATE = 60;      // Frames per Second (FPS)
+	const int SIMULATION_RATE = 120; // Simulation steps per Second
 	const std::string PLAYER_SCENE = "playerScene";
+	const unsigned int SOLID_LAYER = 1;       // Collider layers, one bit each.
+	const unsigned int PLAYER_LAYER = 2;
+	const unsigned int COLLECTIBLE_LAYER = 4;
+	const double SCROLL_SPEED = 0.24; // Speed the levels scroll at (pixels per milisecond).
 }
 
 #endif
@@ -0,0 +1,51 @@
+/**
+ * @file level_data.hpp
+ * @brief Purpose: Contains the LevelData class declaration.
+ *
+ * GPL v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef LEVEL_DATA
+#define LEVEL_DATA
+
+#include "level_format.hpp"
+#include "mapped_file.hpp"
+#include <string>
+
+namespace Azo {
+	/**
+	 * @brief LevelData class.
+	 *
+	 * A compiled level file, mapped into memory. The records are read where
+	 * they are on the file, they're only valid while it stays open.
+	 */
+	class LevelData {
+		public:
+			LevelData();
+
+			bool load(std::string path);
+			void close();
+
+			const LevelHeader &getHeader();
+			const LevelBackground &getBackground(unsigned int index);
+			const LevelAudio &getAudio(unsigned int index);
+			const LevelObstacle &getObstacle(unsigned int index);
+			const LevelBlock *getBlocks(const LevelObstacle &obstacle);
+			const char *getString(uint32_t offset);
+
+		private:
+			engine::MappedFile mFile;
+			const LevelHeader *mHeader = NULL; // NULL when no valid level is open.
+			const LevelBackground *mBackgroundList = NULL;
+			const LevelAudio *mAudioList = NULL;
+			const LevelObstacle *mObstacleList = NULL;
+			const LevelBlock *mBlockList = NULL;
+			const char *mStringTable = NULL;
+
+			bool validate();
+	};
+}
+
+#endif
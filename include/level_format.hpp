@@ -0,0 +1,105 @@
+/**
+ * @file level_format.hpp
+ * @brief Purpose: Declaration of the binary level format.
+ *
+ * GPL v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef LEVEL_FORMAT_HPP
+#define LEVEL_FORMAT_HPP
+
+#include <cstdint>
+
+namespace Azo {
+	/*
+	 * A compiled level file (".azolevel") is, in order and with no padding:
+	 *
+	 *   LevelHeader
+	 *   LevelBackground[backgroundCount]
+	 *   LevelAudio[audioCount]
+	 *   LevelObstacle[obstacleCount]
+	 *   LevelBlock[blockCount]
+	 *   string table (stringTableSize bytes of NUL terminated strings)
+	 *
+	 * Every record only has 4 byte fields, so they stay aligned when the
+	 * file is mapped. Numbers are little endian. Strings are referenced by
+	 * their offset on the string table. Files are written by azo_levelc from
+	 * the text sources in assets/levels.
+	 */
+
+	const char LEVEL_MAGIC[4] = {'A', 'Z', 'O', 'L'};
+	const uint32_t LEVEL_VERSION = 1;
+
+	// Obstacle type names of the text format, in the order of ObstacleType.
+	const char *const LEVEL_OBSTACLE_TYPES[] = {
+		"GROUND",
+		"WESTERN_BOX",
+		"WESTERN_RAISED_BOX",
+		"WESTERN_CAR",
+		"WESTERN_ROCK",
+		"WESTERN_SPIKE",
+		"MACHINE_PART",
+		"WESTERN_POST"
+	};
+	const uint32_t LEVEL_OBSTACLE_TYPE_COUNT = sizeof(LEVEL_OBSTACLE_TYPES) / sizeof(LEVEL_OBSTACLE_TYPES[0]);
+
+	/**
+	 * @brief First record of a level file.
+	 */
+	struct LevelHeader {
+		char magic[4]; // LEVEL_MAGIC.
+		uint32_t version; // LEVEL_VERSION.
+		uint32_t backgroundCount;
+		uint32_t audioCount;
+		uint32_t obstacleCount;
+		uint32_t blockCount;
+		uint32_t stringTableSize; // Bytes.
+		float playerX; // Where the player starts (pixels).
+		float playerY;
+	};
+
+	/**
+	 * @brief Image drawn behind the level, scrolling with it.
+	 */
+	struct LevelBackground {
+		uint32_t path; // String offset.
+		float x; // From the level position (pixels).
+		float y;
+	};
+
+	/**
+	 * @brief Audio of the level.
+	 */
+	struct LevelAudio {
+		uint32_t name; // String offset, name given to the audio controller.
+		uint32_t path; // String offset.
+		uint32_t isMusic; // 1 for music, 0 for a sound effect.
+		uint32_t playOnStart; // 1 to play it when the level starts.
+	};
+
+	/**
+	 * @brief Obstacle of the level, with its blocks.
+	 */
+	struct LevelObstacle {
+		uint32_t name; // String offset.
+		uint32_t type; // Position on LEVEL_OBSTACLE_TYPES.
+		float x; // From the level position (pixels).
+		float y;
+		uint32_t firstBlock; // Position of its first block on the block records.
+		uint32_t blockCount;
+	};
+
+	/**
+	 * @brief Solid box of an obstacle.
+	 */
+	struct LevelBlock {
+		float x; // From the obstacle position (pixels).
+		float y;
+		float width;
+		float height;
+	};
+}
+
+#endif
@@ -0,0 +1,79 @@
+/**
+ * @file level_generator.hpp
+ * @brief Purpose: Contains the LevelGenerator class declaration.
+ *
+ * GPL v3.0 License
+ * Copyright (c) 2017 Azo
+ *
+ * https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#ifndef LEVEL_GENERATOR_HPP
+#define LEVEL_GENERATOR_HPP
+
+#include "level_format.hpp"
+#include "obstacle.hpp"
+#include <vector>
+
+namespace Azo {
+	/**
+	 * @brief An ObstaclePattern struct.
+	 *
+	 * An obstacle the generator may place, at the height level one has it,
+	 * with its solid block.
+	 */
+	struct ObstaclePattern {
+		ObstacleType type;
+		float y; // From the level position (pixels).
+		LevelBlock block; // From the obstacle position.
+		bool slide; // Passed by sliding under it, otherwise by jumping over or onto it.
+		bool landable; // The player can land on it.
+	};
+
+	/**
+	 * @brief LevelGenerator class.
+	 *
+	 * Builds the obstacles of an endless level, one chunk at a time. A chunk
+	 * only depends on the seed and its number, so it's the same whenever it's
+	 * built again. Only obstacles the player can pass with its jump and slide
+	 * are placed, far enough from each other to land between them, and the
+	 * machine parts are within the reach of a jump.
+	 */
+	class LevelGenerator {
+		public:
+			LevelGenerator(uint32_t seed, double chunkWidth, double jumpingSpeed, double gravity, double scrollSpeed);
+
+			void generateChunk(unsigned int chunk, std::vector<LevelObstacle> &obstacleList,
+			                   std::vector<LevelBlock> &blockList);
+			void generateGround(unsigned int chunkCount, std::vector<LevelObstacle> &obstacleList,
+			                    std::vector<LevelBlock> &blockList);
+			unsigned int getMaxObstacles();
+			unsigned int getObstacleTypes();
+			bool mustSlide(ObstacleType obstacleType);
+
+			inline double getChunkWidth() {
+				return mChunkWidth;
+			}
+
+			inline double getJumpHeight() {
+				return mJumpHeight;
+			}
+
+			inline double getJumpLength() {
+				return mJumpLength;
+			}
+
+		private:
+			uint32_t mSeed;
+			double mChunkWidth; // Pixels.
+			double mJumpHeight; // Highest the player gets on a jump (pixels).
+			double mJumpLength; // Distance the level scrolls while the player is on the air (pixels).
+			double mMinimumGap; // Ground left between two obstacles (pixels).
+			double mHighestPartY; // Highest machine part the player reaches (pixels).
+			std::vector<const ObstaclePattern *> mPatternList; // Patterns the player can pass.
+
+			void addObstacle(std::vector<LevelObstacle> &obstacleList, std::vector<LevelBlock> &blockList,
+			                 ObstacleType obstacleType, double x, double y, const LevelBlock *block);
+	};
+}
+
+#endif
@@ -17,6 +17,11 @@
 #include "obstacle.hpp"
 #include "level_one_code.hpp"
 #include "audio_controller.hpp"
+#include "level_data.hpp"
+#include "arena.hpp"
+#include "level_streamer.hpp"
+#include "level_generator.hpp"
+#include <vector>
 
 namespace Azo {
 	/**
@@ -29,15 +34,18 @@ namespace Azo {
     NULLPOINTER,
     EMPTYSTRING,
     WRONGTYPE,
+    NOMATCHINGFILE,
     SUCCESS,
   };
 
 	/**
 	* @brief LevelOne class
 	* This class is used to manage creation and behavior of
-	* game objects, menus and parents.
+	* game objects, menus and parents. The obstacles are streamed: only the
+	* chunks of the level around the camera are built. Endless levels get
+	* their chunks from a LevelGenerator instead of the level file.
 	*/
-	class LevelOne : public engine::Scene {
+	class LevelOne : public engine::Scene, public engine::ChunkLoader {
 		private:
 			//pointers that refers to the background of diferent gameover screens/menus
 			engine::BackgroundComponent *mWinningScreen;
@@ -50,115 +58,68 @@ namespace Azo {
 			//pointers that refers to the selection arrow of some menus
 			engine::GameObject *mArrow;
 			engine::ImageComponent *mArrowImage;
-			//pointers that refers to different backgrounds of the game
-			engine::ImageComponent *mLevelBackground1;
-			engine::ImageComponent *mLevelBackground2;
-			engine::ImageComponent *mLevelBackground3;
 
 			engine::GameObject *mLevelOne;	//pointer that refer to level game object. Contains things such as background, theme, etc.
-
-			// Add new components to level one here.
+			engine::GameObject *mBackground; //pointer that refers to the looping backgrounds of an endless level, NULL otherwise
 
 			engine::AudioController *mAudioController; //pointer that refers to the controller of the audio of level one
-			engine::AudioComponent *mLevelTheme; //pointer that refers to the audio that plays at level one
 
 			LevelOneCode *mLevelCode;
 			Player *mPlayer;
 
-			// Add obstacles here
-
-			//pointers that refers to obstacles' game objects
-			Obstacle *mObstacleCar1;
-			Obstacle *mSpike1;
-			Obstacle *mObstacleAerial1;
-			Obstacle *mPart1;
-			Obstacle *mObstacleAerial2;
-			Obstacle *mObstacleAerial3;
-			Obstacle *mPart2;
-			Obstacle *mObstacleBox1;
-			Obstacle *mObstacleBox2;
-			Obstacle *mObstacleAerial4;
-			Obstacle *mPart3;
-			Obstacle *mObstacleCar2;
-			Obstacle *mPart4;
-			Obstacle *mObstacleAerial5;
-			Obstacle *mObstacleAerial6;
-			Obstacle *mPart5;
-			Obstacle *mObstacleBox3;
-			Obstacle *mObstacleRock1;
-			Obstacle *mPart6;
-			Obstacle *mObstacleAerial7;
-			Obstacle *mObstacleRock2;
-			Obstacle *mPart7;
-			Obstacle *mObstacleAerial8;
-			Obstacle *mObstacleAerial9;
-			Obstacle *mPart8;
-			Obstacle *mPart1_1;
-			Obstacle *mPart41;
-			Obstacle *mPart7_1;
-			Obstacle *mPart9;
-			Obstacle *mObstacleAerial10;
-			Obstacle *mPart10;
-			Obstacle *mObstacleBox01;
-			Obstacle *mObstacleBox21;
-			Obstacle *mObstacleCar3;
-			Obstacle *mPart11;
-			Obstacle *mObstacleAerial11;
-			Obstacle *mPart12;
-			Obstacle *mObstacleAerial12;
-			Obstacle *mPart13;
-			Obstacle *mPart14;
-			Obstacle *mPart15;
-			Obstacle *mPart16;
-			Obstacle *mObstacleAerial13;
-			Obstacle *mSpike2;
-			Obstacle *mObstacleBox4;
-			Obstacle *mSpike3;
-			Obstacle *mObstacleBox5;
-			Obstacle *mSpike4;
-			Obstacle *mObstacleBox6;
-			Obstacle *mObstacleAerial14;
-			Obstacle *mObstacleBox7;
-			Obstacle *mObstacleAerial15;
-			Obstacle *mPart17;
-			Obstacle *mObstacleRock3;
-			Obstacle *mObstacleBox8;
-			Obstacle *mPart18;
-			Obstacle *mObstacleAerial16;
-			Obstacle *mObstacleRock4;
-			Obstacle *mObstacleRock5;
-			Obstacle *mObstacleAerial17;
-			Obstacle *mObstacleBox9;
-			Obstacle *mObstacleBox10;
-			Obstacle *mObstacleAerial18;
-			Obstacle *mObstacleAerial19;
-			Obstacle *mPart19;
-			Obstacle *mObstacleRock6;
-			Obstacle *mObstacleRock7;
-			Obstacle *mObstacleRock8;
-			Obstacle *mObstacleCar4;
-			Obstacle *mPart20;
-			Obstacle *mObstacleCar5;
-			Obstacle *mSpike5;
-			Obstacle *mObstacleBox11;
-			Obstacle *mObstacleAerial20;
-			Obstacle *mPart21;
-			Obstacle *mObstacleAerial21;
-			Obstacle *mObstacleRock9;
-			Obstacle *mObstacleAerial22;
-			Obstacle *mPart22;
-			Obstacle *mGround;
+			std::string mLevelPath; //compiled level file the obstacles, backgrounds and audio come from
+			LevelData mLevelData; //stays open while the level is built, the chunks are read from it
+			engine::LevelStreamer mStreamer; //loads the chunks around the camera
+
+			std::vector<unsigned int> mChunkStartList; //first position of each chunk on mChunkObstacleList, and its end
+			std::vector<unsigned int> mChunkObstacleList; //streamed obstacles of the level file, by chunk
+			std::vector<engine::Arena *> mChunkArenaList; //one for each loaded chunk, the obstacles of the chunk are built there
+			engine::GameObjectHandle mFirstChunkHandle; //scene slots of the loaded chunks start here
+			unsigned int mChunkCapacity; //most obstacles of a chunk, the slots each loaded chunk has
+			unsigned int mStartChunkCount; //chunks loaded at the start, kept on slots of their own for the snapshot
+			unsigned int mBuiltStartChunkCount; //chunks loaded at the start already built, they're built in order
+			double mStartViewLeft; //left side of the camera after init, where the snapshot has the chunks loaded
+			std::vector<Obstacle *> mObstacleList; //obstacles wider than a chunk, then the slots of the chunks (NULL when empty)
+			unsigned int mResidentObstacleCount; //obstacles wider than a chunk, never released
+			unsigned int mStreamedTypes; //bit of each ObstacleType streamed
+
+			bool mEndless = false; //the chunks come from mGenerator, the level never ends
+			uint32_t mSeed = 0; //seed of the endless level
+			LevelGenerator *mGenerator; //builds the chunks of an endless level, NULL otherwise
+			Obstacle *mGround; //ground of an endless level, under the chunks loaded, NULL otherwise
+			std::vector<LevelObstacle> mGeneratedObstacleList; //obstacles of the chunk being generated
+			std::vector<LevelBlock> mGeneratedBlockList; //their blocks
 			FunctionStatusLevelOne errorCode = FunctionStatusLevelOne::SUCCESS;
 
 		public:
 			LevelOne();
 			LevelOne(std::string name);
+			LevelOne(std::string name, uint32_t seed);
+			void init(); //function that inits level one and loads the chunks at its start
+			void shutdown(); //function that releases the chunks and shuts level one down
 			void restart(); //function that restarts level one
+			void restoreSnapshot(); //function that goes back to the chunks at the start before restoring
+			void collectAssets(engine::AssetList &assetList); //function that also lists the assets of the streamed obstacles
+
+			//function that gives the generator of an endless level, NULL for the others
+			inline LevelGenerator *getGenerator() {
+				return mGenerator;
+			}
+
+			void loadChunk(unsigned int chunk); //function that builds the obstacles of a chunk
+			void releaseChunk(unsigned int chunk); //function that takes down the obstacles of a chunk
 
 		private:
 			void createGameObjects(); //function that add new objects to level one
+			void createLevelComponents(); //function that add the backgrounds and audio of the level file
+			void createObstacles(); //function that add the obstacles wider than a chunk and split the others in chunks
+			void createGenerator(); //function that add the generator of an endless level
+			void createChunkSlots(); //function that reserve the scene slots and arenas of the loaded chunks
+			unsigned int findChunkSlot(unsigned int chunk); //function that gives the slot of a chunk
+			void placeObstacle(unsigned int slot, unsigned int index, Obstacle &obstacle); //function that puts a built obstacle on its chunk slot
+			Obstacle *createObstacle(engine::Arena &arena, const LevelObstacle &levelObstacle); //function that builds an obstacle of the level file
 			void createEndingScreen(); //functon that add the ending menu to level one
-			void addLevelParents(); //function that add parents to level one. Use after adding objects that collide.
+			void addLevelParents(); //function that add the other parents to level one. Use after adding objects that collide.
 			void errorLog(std::string file);
 
 	};
@@ -15,6 +15,8 @@
 #include "player.hpp"
 #include "obstacle.hpp"
 #include "audio_controller.hpp"
+#include "level_streamer.hpp"
+#include <vector>
 
 namespace Azo {
 	/**
@@ -25,41 +27,45 @@ namespace Azo {
 	class LevelOneCode : public engine::CodeComponent {
 		private:
 			Player *mPlayer;
-			std::list<Obstacle *> mObstacleList;
+			engine::LevelStreamer *mStreamer;
 			engine::AudioController *mAudioController;
 			engine::GameObject *mLosingParts;
 			engine::GameObject *mLosingDeath;
 			engine::GameObject *mWinningScreen;
 			engine::GameObject *mArrow;
-
 			double mWaitingTime = 0.0; // technique 33
 			int mCurrentOption = 1;
+			std::string mSceneName; // Scene started again on retry.
+			bool mEndless = false; // The level never ends.
+			engine::GameObject *mBackground = NULL; // Backgrounds of an endless level, looping.
+			double mBackgroundLoopWidth = 0.0;
 
 		public:
-			LevelOneCode(engine::GameObject &gameObject);
+			LevelOneCode(
+				engine::GameObject &gameObject,
+				engine::LevelStreamer &streamer,
+				std::string sceneName
+			);
+			void setEndless(engine::GameObject &background, double loopWidth);
 			void shutdown();
+			void saveState(engine::StateBuffer &stateBuffer);
+			void loadState(engine::StateBuffer &stateBuffer);
 
 		private:
-			void findAudioController();
 			void updateCode();
+			void updateScrolling();
+			void updateBackground();
 			void changeOption();
 			void chooseOption();
-			void updateObstaclePosition();
 			void getParents();
-			bool hasGround(double *groundY);
-			bool hasCeiling(double *groundY);
-			bool hasWallOnRight(double *wallX);
-			bool hasWallOnLeft(double *wallX);
 			void updatePhysics();
-			void maxPosition(Player *mPlayer, engine::GameObject *gameObject);
+			void maxPosition(Player *mPlayer);
 			void checkCollisions(Player *mPlayer);
 			void checkJumpSlide(Player *mPlayer);
 			void updatePlayerPosition(Player *mPlayer);
 			void handleCollisionGround(Obstacle *obstacle, Player *mPlayer);
 			void handleCollisionSide(Obstacle *obstacle, Player *mPlayer, double *wallX, double offset, double blockSide);
 			void handleCollisionCeiling(Obstacle *obstacle, Player *mPlayer, double *groundY, double blockBottom);
-			bool collectMachinePart(double playerTop, double playerBottom, double playerRight, double playerLeft,
-									  Obstacle *obstacle, Player *mPlayer, std::list<Obstacle *> mObstacleList);
 	};
 }
 
@@ -12,6 +12,7 @@
 
 #include "code_component.hpp"
 #include "audio_controller.hpp"
+#include "collider_component.hpp"
 
 namespace Azo {
 	class Obstacle;
@@ -22,7 +23,8 @@ namespace Azo {
 		 *
 	     * A more elaborate class description.
 		 * Class responsible for the creation of the parts by which the player must
-		 * collect to get to victory.
+		 * collect to get to victory. Parts are collected when the player enters
+		 * their trigger, so they do nothing on the frames in between.
 	     */
 	class MachinePartCode : public engine::CodeComponent {
 		private:
@@ -33,10 +35,9 @@ namespace Azo {
 			virtual ~MachinePartCode();
 			MachinePartCode(Obstacle *machinePart);
 			void shutdown();
+			void onCollision(engine::CollisionEvent event, engine::ColliderComponent &other);
 		
 		private:
-			void updateCode();
-			void findAudioController();
 	};
 }
 #endif
@@ -52,6 +52,7 @@ namespace Azo {
 		public:
 			Menu();
 			Menu(std::string name);
+			void init();
 			void restart();
 			void shutdown();
 
@@ -55,8 +55,6 @@ namespace Azo {
 			MenuCode(engine::GameObject *gameObject);
 
 		private:
-			void findAudioController();
-			void findAnimationController();
 			void changeOption();
 			void updateCode();
 			void errorLog(std::string file);
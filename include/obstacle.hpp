@@ -11,8 +11,10 @@
 #define OBSTACLE
 
 #include "game_object.hpp"
-#include "invisible_block.hpp"
+#include "collider_component.hpp"
 #include "machine_part_code.hpp"
+#include "game_globals.hpp"
+#include "level_format.hpp"
 
 namespace Azo {
 	/**
@@ -42,7 +44,6 @@ namespace Azo {
 		COLLECTED,
 		NON_COLLECTED,
 		NON_MACHINE,
-		FINISHED,
 	};
 
 	/**
@@ -63,16 +64,29 @@ namespace Azo {
 	 */
 	class Obstacle : public engine::GameObject {
 		public:
-			std::pair<double, double> mPositionRelativeToParent;
-			std::list<InvisibleBlock *> mBlockList;
 			ObstacleType mObstacleType;
 			MachinePartState mMachinePartState = MachinePartState::NON_MACHINE;
 
 			Obstacle();
-			Obstacle(std::string name, std::pair<double, double> positionRelativeToParent, ObstacleType obstacleType);
+			Obstacle(
+				std::string name,
+				std::pair<double, double> positionRelativeToParent,
+				ObstacleType obstacleType,
+				engine::Arena &arena
+			);
+			Obstacle(
+				std::string name,
+				std::pair<double, double> positionRelativeToParent,
+				ObstacleType obstacleType,
+				const LevelBlock *blockList,
+				unsigned int blockCount,
+				engine::Arena &arena
+			);
 			virtual ~Obstacle();
 
 			void shutdown();
+			void saveState(engine::StateBuffer &stateBuffer);
+			void loadState(engine::StateBuffer &stateBuffer);
 			void errorLog(std::string file);
 			/**
 			 * @brief Method for class name.
@@ -91,13 +105,17 @@ namespace Azo {
 			engine::AudioComponent *mCollected = NULL;
 			std::vector<engine::Sprite *> mSpinningAnimationSprites;
 			MachinePartCode *mMachinePartCode = NULL;
+			std::vector<engine::ColliderComponent *> mColliderList; // Solid blocks, or the trigger of a machine part.
 			FunctionStatusObstacle errorCode = FunctionStatusObstacle::SUCCESS;
+			// Blocks given by a level, NULL for the blocks of the type. Only read while building.
+			const LevelBlock *mLevelBlockList = NULL;
+			unsigned int mLevelBlockCount = 0;
 
 			void createComponents();
 			void createBlocks();
 			void generateSpinAnimation();
 
-			void clearEachBlock();
+			void clearColliders();
 			void clearAnimations();
 			void clearImages();
 			void clearAudio();
@@ -115,11 +133,10 @@ namespace Azo {
 				unsigned int spriteNumber,
 				unsigned int spriteX
 			);
-			void setObstaclePosition(
-				std::string blockName,
-				std::pair<double, double> blockPosition,
-				double pairFirst,
-				double pairSecond
+			void addBlock(
+				std::pair<double, double> blockOffset,
+				double blockWidth,
+				double blockHeight
 			);
 	};
 }
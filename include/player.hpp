@@ -18,6 +18,7 @@
 #include <string>
 #include "game_object.hpp"
 #include "sprite.hpp"
+#include "collider_component.hpp"
 #include "player_code.hpp"
 #include "obstacle.hpp"
 
@@ -43,13 +44,13 @@ namespace Azo {  //Used to avoid writing all the path from Azo context
 	class Player : public engine::GameObject {
 		public:
 			Player();
-			Player(std::string name, std::pair<double, double> currentPosition);
+			Player(std::string name, std::pair<double, double> currentPosition, engine::Arena &arena);
 
 			const std::pair<double, double> M_ZERO_VECTOR = std::make_pair(0.0f, 0.0f); //constant pair of double. Always [0.0f, 0.0f]
 			const double M_GRAVITY = 0.003f; //constant double for gravity. The vertical movement
 			const double M_JUMPING_SPEED = -1.0f; //constante double. Used along M_GRAVITY to set the vertical movement.
 			//Vertical speed should be negative, so the character goes up on canvas.
-			const double M_WALKING_SPEED = 4.8f; //constant double for speed. The horizontal movement
+			const double M_WALKING_SPEED = 0.288f; //constant double for speed. The horizontal movement (pixels per milisecond)
 			const int M_TOTAL_PARTS = 25; //constant integer for the total parts objects present in game
 			PlayerState mState; //PlayerState variable of PlayerState enum class
 			std::pair<double, double> mSpeed; //pair of double to set mSpeed
@@ -60,6 +61,17 @@ namespace Azo {  //Used to avoid writing all the path from Azo context
 			int mCollectedParts = 0; // integer, ranges 0 to 25
 
 			void shutdown();
+			void saveState(engine::StateBuffer &stateBuffer);
+			void loadState(engine::StateBuffer &stateBuffer);
+
+			/**
+			 * @brief access the player collider.
+			 *
+			 * @return the collider, whose manifold has the contacts of the last step.
+			*/
+			inline engine::ColliderComponent& getCollider() {
+				return *mCollider;
+			}
 			
 		private:
 			engine::AnimationController *mAnimationController; //pointer to corresponding current animation
@@ -83,6 +95,7 @@ namespace Azo {  //Used to avoid writing all the path from Azo context
 			std::vector<engine::Sprite *> mVictoryAnimationSprites; //pointer to corresponding sprite
 
 			PlayerCode *mPlayerCode;
+			engine::ColliderComponent *mCollider; //box of the player on the physics world
 
 			void createComponents();
 
@@ -43,8 +43,6 @@ namespace Azo { //Used to avoid writing all the path from Azo context
 			void slidingTest();
 			void collectedTeste();
 			void updatePhysics();
-			void findAnimationController();
-			void findAudioController();
 
 	};
 }
@@ -0,0 +1,194 @@
+/**
+* @file level_data.cpp
+* @brief Purpose: Contains the LevelData class methods.
+*
+* GPL v3.0 License
+* Copyright (c) 2017 Azo
+*
+* https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "level_data.hpp"
+#include "log.h"
+#include <cstring>
+
+using namespace Azo;
+
+/**
+* @brief Basic contructor for LevelData.
+*
+* No level is open until "load".
+*/
+LevelData::LevelData() {}
+
+/**
+* @brief Method to open a compiled level.
+*
+* Maps the file and checks every record before anything reads it, so a
+* broken file is refused as a whole.
+* @param path Path of the ".azolevel" file.
+* @return true when the level is valid.
+*/
+bool LevelData::load(std::string path) {
+	close();
+
+	if (!mFile.open(path)) {
+		return false;
+	} else if (!validate()) {
+		INFO("Invalid level file " << path);
+		close();
+		return false;
+	} else {
+		DEBUG("Loaded level " << path << " (" << mFile.getSize() << " bytes, "
+		      << mHeader->obstacleCount << " obstacles).");
+		return true;
+	}
+}
+
+/**
+* @brief Method to close the level.
+*
+* Records read from it become invalid.
+*/
+void LevelData::close() {
+	mFile.close();
+	mHeader = NULL;
+	mBackgroundList = NULL;
+	mAudioList = NULL;
+	mObstacleList = NULL;
+	mBlockList = NULL;
+	mStringTable = NULL;
+}
+
+/**
+* @brief Method to check the mapped file.
+*
+* Used to find where each list of records starts, once the sizes on the
+* header match the file and every reference stays inside it.
+* @return true when the file is a valid level.
+*/
+bool LevelData::validate() {
+	const unsigned char *data = mFile.getData();
+	uint64_t fileSize = mFile.getSize();
+
+	if (fileSize < sizeof(LevelHeader)) {
+		return false;
+	} else {
+		//Nothing to do. The header can be read.
+	}
+
+	const LevelHeader *header = reinterpret_cast<const LevelHeader *>(data);
+
+	if (std::memcmp(header->magic, LEVEL_MAGIC, sizeof(LEVEL_MAGIC)) != 0 || header->version != LEVEL_VERSION) {
+		return false;
+	} else {
+		//Nothing to do. It's a level of this version.
+	}
+
+	uint64_t backgroundStart = sizeof(LevelHeader);
+	uint64_t audioStart = backgroundStart + uint64_t(header->backgroundCount) * sizeof(LevelBackground);
+	uint64_t obstacleStart = audioStart + uint64_t(header->audioCount) * sizeof(LevelAudio);
+	uint64_t blockStart = obstacleStart + uint64_t(header->obstacleCount) * sizeof(LevelObstacle);
+	uint64_t stringStart = blockStart + uint64_t(header->blockCount) * sizeof(LevelBlock);
+	uint32_t stringTableSize = header->stringTableSize;
+
+	if (stringStart + stringTableSize != fileSize || stringTableSize == 0 ||
+	    data[fileSize - 1] != '\0') {
+		return false;
+	} else {
+		//Nothing to do. The records fill the file.
+	}
+
+	const LevelBackground *backgroundList = reinterpret_cast<const LevelBackground *>(data + backgroundStart);
+	const LevelAudio *audioList = reinterpret_cast<const LevelAudio *>(data + audioStart);
+	const LevelObstacle *obstacleList = reinterpret_cast<const LevelObstacle *>(data + obstacleStart);
+	bool valid = true;
+
+	for (uint32_t index = 0; index < header->backgroundCount; index++) {
+		valid = valid && backgroundList[index].path < stringTableSize;
+	}
+
+	for (uint32_t index = 0; index < header->audioCount; index++) {
+		valid = valid && audioList[index].name < stringTableSize && audioList[index].path < stringTableSize;
+	}
+
+	for (uint32_t index = 0; index < header->obstacleCount; index++) {
+		const LevelObstacle &obstacle = obstacleList[index];
+		valid = valid && obstacle.name < stringTableSize && obstacle.type < LEVEL_OBSTACLE_TYPE_COUNT &&
+		        obstacle.firstBlock <= header->blockCount &&
+		        obstacle.blockCount <= header->blockCount - obstacle.firstBlock;
+	}
+
+	if (valid) {
+		mHeader = header;
+		mBackgroundList = backgroundList;
+		mAudioList = audioList;
+		mObstacleList = obstacleList;
+		mBlockList = reinterpret_cast<const LevelBlock *>(data + blockStart);
+		mStringTable = reinterpret_cast<const char *>(data + stringStart);
+	} else {
+		//Nothing to do. The level stays closed.
+	}
+
+	return valid;
+}
+
+/**
+* @brief Method for the header of the level.
+*
+* @return Header with the count of each record.
+*/
+const LevelHeader &LevelData::getHeader() {
+	ASSERT(mHeader != NULL, "No level is open.");
+	return *mHeader;
+}
+
+/**
+* @brief Method for a background of the level.
+*
+* @param index Position of the background, smaller than backgroundCount.
+*/
+const LevelBackground &LevelData::getBackground(unsigned int index) {
+	ASSERT(mHeader != NULL && index < mHeader->backgroundCount, "No such background.");
+	return mBackgroundList[index];
+}
+
+/**
+* @brief Method for an audio of the level.
+*
+* @param index Position of the audio, smaller than audioCount.
+*/
+const LevelAudio &LevelData::getAudio(unsigned int index) {
+	ASSERT(mHeader != NULL && index < mHeader->audioCount, "No such audio.");
+	return mAudioList[index];
+}
+
+/**
+* @brief Method for an obstacle of the level.
+*
+* @param index Position of the obstacle, smaller than obstacleCount.
+*/
+const LevelObstacle &LevelData::getObstacle(unsigned int index) {
+	ASSERT(mHeader != NULL && index < mHeader->obstacleCount, "No such obstacle.");
+	return mObstacleList[index];
+}
+
+/**
+* @brief Method for the blocks of an obstacle.
+*
+* @param obstacle Obstacle of this level.
+* @return The first of its blockCount blocks.
+*/
+const LevelBlock *LevelData::getBlocks(const LevelObstacle &obstacle) {
+	ASSERT(mHeader != NULL, "No level is open.");
+	return mBlockList + obstacle.firstBlock;
+}
+
+/**
+* @brief Method for a string of the level.
+*
+* @param offset Offset of the string on the string table.
+*/
+const char *LevelData::getString(uint32_t offset) {
+	ASSERT(mHeader != NULL && offset < mHeader->stringTableSize, "No such string.");
+	return mStringTable + offset;
+}
@@ -0,0 +1,244 @@
+/**
+* @file level_generator.cpp
+* @brief Purpose: Contains the LevelGenerator class methods.
+*
+* GPL v3.0 License
+* Copyright (c) 2017 Azo
+*
+* https://github.com/TecProg2018-2/Azo/blob/master/LICENSE.md
+*/
+#include "level_generator.hpp"
+#include "log.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace Azo;
+
+// Ground of level one (pixels).
+const double GROUND_Y = 404.5;
+const double GROUND_HEIGHT = 100.0;
+// Measures of the player animations: the widest is sliding (pixels).
+const double PLAYER_WIDTH = 106.0;
+const double PLAYER_HEIGHT = 119.0;
+const double PLAYER_SLIDE_HEIGHT = 80.0;
+const double PLAYER_SINK = 15.0; // The player stands this deep into the ground (pixels).
+const double PART_SIZE = 36.0; // Machine part sprite (pixels).
+const double REACH_MARGIN = 10.0; // Left between the player and what it must reach or pass (pixels).
+const double GAP_VARIATION = 1.5; // Gaps go up to this much over the minimum one.
+const double PART_CHANCE = 0.6; // Chance of a machine part on each gap.
+const unsigned int CLEAR_CHUNKS = 1; // Chunks with ground only, where the player starts.
+
+// Obstacles of level one, standing where it has them.
+const ObstaclePattern PATTERNS[] = {
+	{ObstacleType::WESTERN_ROCK, 340.0f, {80.0f, 12.0f, 4.0f, 100.0f}, false, false},
+	{ObstacleType::WESTERN_BOX, 300.0f, {58.0f, 6.0f, 63.0f, 73.0f}, false, true},
+	{ObstacleType::WESTERN_CAR, 300.0f, {69.0f, 20.0f, 109.0f, 143.0f}, false, true},
+	{ObstacleType::WESTERN_SPIKE, 340.0f, {19.0f, 23.0f, 210.0f, 92.0f}, false, false},
+	{ObstacleType::WESTERN_RAISED_BOX, 250.0f, {35.0f, 6.0f, 50.0f, 68.0f}, true, false},
+	{ObstacleType::WESTERN_POST, 185.0f, {48.0f, 32.0f, 23.0f, 106.0f}, true, false}
+};
+const unsigned int PATTERN_COUNT = sizeof(PATTERNS) / sizeof(PATTERNS[0]);
+
+// SplitMix64, the numbers are the same on every platform, unlike the ones of <random>.
+static uint64_t nextRandom(uint64_t &state) {
+	state += 0x9E3779B97F4A7C15ULL;
+	uint64_t value = state;
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+	return value ^ (value >> 31);
+}
+
+// Between 0 and 1, 1 excluded.
+static double nextUnit(uint64_t &state) {
+	return (nextRandom(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+* @brief Constructor class for LevelGenerator.
+*
+* Works out how high and how far the player jumps, and keeps the patterns
+* it can pass.
+* @param seed Seed of the level, the same seed gives the same level.
+* @param chunkWidth Width of each chunk (pixels).
+* @param jumpingSpeed Vertical speed the player jumps with (pixels per milisecond).
+* @param gravity Vertical acceleration of the player (pixels per squared milisecond).
+* @param scrollSpeed Speed the level scrolls at (pixels per milisecond).
+*/
+LevelGenerator::LevelGenerator(uint32_t seed, double chunkWidth, double jumpingSpeed, double gravity,
+                               double scrollSpeed) {
+	ASSERT(chunkWidth > 0.0, "The chunk width must be positive.");
+	ASSERT(gravity > 0.0, "The gravity must be positive.");
+	ASSERT(scrollSpeed > 0.0, "The scroll speed must be positive.");
+	mSeed = seed;
+	mChunkWidth = chunkWidth;
+	mJumpHeight = jumpingSpeed * jumpingSpeed / (2.0 * gravity);
+	mJumpLength = scrollSpeed * 2.0 * std::fabs(jumpingSpeed) / gravity;
+	// The player lands before the next obstacle, with room to jump again.
+	mMinimumGap = mJumpLength + PLAYER_WIDTH;
+	mHighestPartY = GROUND_Y + PLAYER_SINK - PLAYER_HEIGHT - mJumpHeight - PART_SIZE + REACH_MARGIN;
+
+	for (unsigned int index = 0; index < PATTERN_COUNT; index++) {
+		const ObstaclePattern &pattern = PATTERNS[index];
+		bool passable = false;
+
+		if (pattern.slide) {
+			double clearance = GROUND_Y - (pattern.y + pattern.block.y + pattern.block.height);
+			passable = clearance + PLAYER_SINK >= PLAYER_SLIDE_HEIGHT + REACH_MARGIN;
+		} else {
+			double height = GROUND_Y + PLAYER_SINK - (pattern.y + pattern.block.y);
+			passable = height <= mJumpHeight - REACH_MARGIN &&
+			           (pattern.landable || pattern.block.width + PLAYER_WIDTH <= mJumpLength);
+		}
+
+		if (passable) {
+			mPatternList.push_back(&pattern);
+		} else {
+			DEBUG("The player can't pass obstacle type " << LEVEL_OBSTACLE_TYPES[static_cast<int>(pattern.type)]);
+		}
+	}
+
+	ASSERT(mPatternList.empty() == false, "The player must be able to pass some obstacle.");
+	ASSERT(mMinimumGap < chunkWidth, "The chunks must fit an obstacle between two gaps.");
+}
+
+/**
+* @brief Method to build the obstacles of a chunk.
+*
+* Obstacles with gaps of at least mMinimumGap between them, some with a
+* machine part over them. Half of a gap is left at each side of the chunk,
+* so chunks can follow each other. The chunks have no ground, see
+* "generateGround". The lists are cleared first, and keep their memory.
+* @param chunk Number of the chunk.
+* @param obstacleList Gets the obstacles, positioned from the level.
+* @param blockList Gets their blocks, which the obstacles point to.
+*/
+void LevelGenerator::generateChunk(unsigned int chunk, std::vector<LevelObstacle> &obstacleList,
+                                   std::vector<LevelBlock> &blockList) {
+	obstacleList.clear();
+	blockList.clear();
+
+	uint64_t state = (static_cast<uint64_t>(mSeed) << 32) | chunk;
+	double chunkLeft = chunk * mChunkWidth;
+
+	if (chunk < CLEAR_CHUNKS) {
+		return;
+	} else {
+		//Nothing to do. The chunk gets obstacles.
+	}
+
+	double position = mMinimumGap / 2.0;
+
+	while (true) {
+		const ObstaclePattern &pattern = *mPatternList[nextRandom(state) % mPatternList.size()];
+		double width = pattern.block.x + pattern.block.width;
+
+		if (position + width + mMinimumGap / 2.0 > mChunkWidth) {
+			return;
+		} else {
+			//Nothing to do. The obstacle fits the chunk.
+		}
+
+		addObstacle(obstacleList, blockList, pattern.type, chunkLeft + position, pattern.y, &pattern.block);
+		position += width;
+
+		double gap = mMinimumGap * (1.0 + nextUnit(state) * GAP_VARIATION);
+		double partPosition = position + gap / 2.0 - PART_SIZE / 2.0;
+
+		if (nextUnit(state) < PART_CHANCE && partPosition + PART_SIZE < mChunkWidth) {
+			double partY = mHighestPartY + nextUnit(state) * (GROUND_Y + PLAYER_SINK - PLAYER_HEIGHT - mHighestPartY);
+			addObstacle(obstacleList, blockList, ObstacleType::MACHINE_PART, chunkLeft + partPosition, partY, NULL);
+		} else {
+			//Nothing to do. The gap stays empty.
+		}
+
+		position += gap;
+	}
+}
+
+/**
+* @brief Method to build the ground.
+*
+* A single block, so the player never walks over the side of another one:
+* the level moves it along with the chunks loaded.
+* @param chunkCount Chunks the ground covers.
+* @param obstacleList Gets the ground, at the start of the level.
+* @param blockList Gets its block.
+*/
+void LevelGenerator::generateGround(unsigned int chunkCount, std::vector<LevelObstacle> &obstacleList,
+                                    std::vector<LevelBlock> &blockList) {
+	obstacleList.clear();
+	blockList.clear();
+
+	LevelBlock groundBlock = {0.0f, 0.0f, static_cast<float>(chunkCount * mChunkWidth), static_cast<float>(GROUND_HEIGHT)};
+	addObstacle(obstacleList, blockList, ObstacleType::GROUND, 0.0, GROUND_Y, &groundBlock);
+}
+
+/**
+* @brief Method for the size of the chunks.
+*
+* Each obstacle takes at least the narrowest pattern and a gap, a machine
+* part may come with it.
+* @return Most obstacles of a chunk.
+*/
+unsigned int LevelGenerator::getMaxObstacles() {
+	double narrowestWidth = mChunkWidth;
+
+	for (auto eachPattern : mPatternList) {
+		narrowestWidth = std::min(narrowestWidth, static_cast<double>(eachPattern->block.x + eachPattern->block.width));
+	}
+
+	return 2 * (static_cast<unsigned int>(mChunkWidth / (narrowestWidth + mMinimumGap)) + 1);
+}
+
+/**
+* @brief Method for the obstacle types placed.
+*
+* @return Bit of each ObstacleType the chunks may have.
+*/
+unsigned int LevelGenerator::getObstacleTypes() {
+	unsigned int obstacleTypes = 1u << static_cast<int>(ObstacleType::MACHINE_PART);
+
+	for (auto eachPattern : mPatternList) {
+		obstacleTypes |= 1u << static_cast<int>(eachPattern->type);
+	}
+
+	return obstacleTypes;
+}
+
+/**
+* @brief Method to tell how an obstacle type is passed.
+*
+* @param obstacleType Type of a placed obstacle.
+* @return true when the player must slide under it, false to jump.
+*/
+bool LevelGenerator::mustSlide(ObstacleType obstacleType) {
+	for (auto eachPattern : mPatternList) {
+		if (eachPattern->type == obstacleType) {
+			return eachPattern->slide;
+		} else {
+			//Nothing to do. Keep looking.
+		}
+	}
+
+	return false;
+}
+
+/**
+* @brief Method to add an obstacle to a chunk.
+*
+* @param block Its solid block, NULL for none.
+*/
+void LevelGenerator::addObstacle(std::vector<LevelObstacle> &obstacleList, std::vector<LevelBlock> &blockList,
+                                 ObstacleType obstacleType, double x, double y, const LevelBlock *block) {
+	LevelObstacle obstacle = {0, static_cast<uint32_t>(obstacleType), static_cast<float>(x), static_cast<float>(y),
+	                          static_cast<uint32_t>(blockList.size()), 0};
+
+	if (block != NULL) {
+		blockList.push_back(*block);
+		obstacle.blockCount = 1;
+	} else {
+		//Nothing to do. Machine parts have no blocks.
+	}
+
+	obstacleList.push_back(obstacle);
+}
@@ -10,527 +10,471 @@
 */
 
 #include "level_one.hpp"
+#include "assets_manager.hpp"
+#include <algorithm>
 #include <ctime>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <string>
 
 using namespace Azo;
 
-LevelOne::LevelOne() {}
+// Bytes of each chunk of the arena of a loaded level chunk, the obstacles of one fit in it.
+const std::size_t CHUNK_ARENA_CHUNK_SIZE = 16 * 1024;
+// Bytes of each chunk of the arena of an asset sample, one obstacle fits in it.
+const std::size_t SAMPLE_ARENA_CHUNK_SIZE = 4 * 1024;
+// The level is streamed in chunks of this width (pixels), wider obstacles are never released.
+const double LEVEL_CHUNK_WIDTH = 1024.0;
+// Chunks kept loaded behind the camera, so an obstacle is off the screen when its chunk is released.
+const unsigned int LEVEL_CHUNKS_BEHIND = 1;
+// Chunks loaded ahead of the camera, so obstacles are built before they show up.
+const unsigned int LEVEL_CHUNKS_AHEAD = 1;
+// Where the level starts, the snapshot is saved with it there.
+const std::pair<double, double> LEVEL_START_POSITION = std::make_pair(0.0, 0.0);
+
+LevelOne::LevelOne() :
+	mStreamer(*this, LEVEL_CHUNK_WIDTH, LEVEL_CHUNKS_BEHIND, LEVEL_CHUNKS_AHEAD) {}
 
 //constructor that inits level one and its game objects
-LevelOne::LevelOne(std::string name){
+LevelOne::LevelOne(std::string name) :
+	mStreamer(*this, LEVEL_CHUNK_WIDTH, LEVEL_CHUNKS_BEHIND, LEVEL_CHUNKS_AHEAD) {
 	ASSERT(name != "", "Name can`t be blank.");
 	this->sceneName = name;
+	// The obstacles, backgrounds and audio come from the compiled level of the same name.
+	mLevelPath = "levels/" + name + ".azolevel";
+	// Retrying restores the state saved after init instead of recreating every object.
+	this->snapshotEnabled = true;
 	createGameObjects();
 }
 
+//constructor that inits an endless level and its game objects, the obstacles come from the seed
+LevelOne::LevelOne(std::string name, uint32_t seed) :
+	mStreamer(*this, LEVEL_CHUNK_WIDTH, LEVEL_CHUNKS_BEHIND, LEVEL_CHUNKS_AHEAD) {
+	ASSERT(name != "", "Name can`t be blank.");
+	this->sceneName = name;
+	// The backgrounds and audio come from the compiled level of the same name.
+	mLevelPath = "levels/" + name + ".azolevel";
+	this->snapshotEnabled = true;
+	mEndless = true;
+	mSeed = seed;
+	createGameObjects();
+}
+
+//function that inits level one, then builds the chunks the camera starts on
+void LevelOne::init() {
+	engine::Scene::init();
+	mStartViewLeft = engine::Game::instance.getCamera().getPosition().first;
+	mStreamer.update(mStartViewLeft, global::WINDOWN_WIDTH);
+}
+
+//function that releases the loaded chunks before shutting level one down
+void LevelOne::shutdown() {
+	mStreamer.releaseAll();
+	engine::Scene::shutdown();
+	mLevelData.close();
+
+	// The arenas of the chunks and the generator were released with the scene arena.
+	mChunkArenaList.clear();
+	mObstacleList.clear();
+	mBuiltStartChunkCount = 0;
+	mGenerator = NULL;
+	mGround = NULL;
+}
+
 //function that restarts level one
 void LevelOne::restart(){
 	gameObjectMap.clear();
-	//To Do: add objects to be recreated one by one here, instead of recalling createGameObjects.
 	createGameObjects();
 }
 
+//function that restores level one as it was after init
+void LevelOne::restoreSnapshot() {
+	// The snapshot has the chunks the camera started on. They're still built, on slots of their own, so going back
+	// to them only releases the chunks streamed since.
+	mStreamer.update(mStartViewLeft, global::WINDOWN_WIDTH);
+	engine::Scene::restoreSnapshot();
+}
+
+//function that lists the assets of level one, with the ones of the obstacles not streamed yet
+void LevelOne::collectAssets(engine::AssetList &assetList) {
+	engine::Scene::collectAssets(assetList);
+
+	if (mGameObjectList.empty()) {
+		//Nothing to do. Level one was shut down, its assets stay loaded.
+	} else {
+		for (unsigned int type = 0; type < LEVEL_OBSTACLE_TYPE_COUNT; type++) {
+			if ((mStreamedTypes & (1u << type)) != 0) {
+				// An obstacle of the type, never initialized, tells the assets of every other.
+				engine::Arena sampleArena(SAMPLE_ARENA_CHUNK_SIZE);
+				Obstacle sample("asset_sample", LEVEL_START_POSITION, static_cast<ObstacleType>(type), sampleArena);
+				sample.collectAssets(assetList);
+				sample.shutdown();
+			} else {
+				//Nothing to do. The level has no streamed obstacle of this type.
+			}
+		}
+	}
+}
+
 //function that create all new game objects of level one in order.
 void LevelOne::createGameObjects() {
 	DEBUG("Creating LevelOne GameObjects.");
+	// A restart without a shutdown leaves the objects of the last run, they go all at once.
+	mArena.reset();
+	mObstacleList.clear();
+	mChunkArenaList.clear();
+	mChunkCapacity = 0;
+	mStartChunkCount = 0;
+	mBuiltStartChunkCount = 0;
+	mStartViewLeft = 0.0;
+	mResidentObstacleCount = 0;
+	mStreamedTypes = 0;
+	mStreamer.setChunkCount(0);
+	mGenerator = NULL;
+	mGround = NULL;
+	mBackground = NULL;
+
 	//creating main game object of level one
-	DEBUG("Creating LevelOne Object."); // technique 29
-	mLevelOne = new engine::GameObject("level_one", std::make_pair(0, 0));
-	//instantiates level one background
-	mLevelBackground1 = new engine::ImageComponent(*mLevelOne, "backgrounds/level_one_part_one.png", 1);
-	mLevelOne->addComponent(*mLevelBackground1);
-	mLevelBackground2 = new engine::ImageComponent(*mLevelOne, "backgrounds/level_one_part_two.png", 1, std::make_pair(8188, 0));
-	mLevelOne->addComponent(*mLevelBackground2);
-	mLevelBackground3 = new engine::ImageComponent(*mLevelOne, "backgrounds/level_one_part_three.png", 1, std::make_pair(16379, 0));
-	mLevelOne->addComponent(*mLevelBackground3);
-	//instantiates level one audio, and its controller
-	mAudioController = new engine::AudioController();
-	mLevelTheme = new engine::AudioComponent(*mLevelOne, "audios/banjo.ogg", true, true);
-	mAudioController->addAudio("tema_level_one", *mLevelTheme);
-	mLevelOne->addComponent(*mAudioController);
+	mLevelOne = mArena.create<engine::GameObject>("level_one", LEVEL_START_POSITION);
 	this->addGameObject(*mLevelOne);
-	if(mLevelBackground1 == NULL) {
-		errorCode = FunctionStatusLevelOne::NULLPOINTER;
-		errorLog("LevelOne::findLevelBackground1"); // technique 32
-	} else {
-		errorCode = FunctionStatusLevelOne::SUCCESS;
-	}
-	if(mLevelBackground2 == NULL) {
-		errorCode = FunctionStatusLevelOne::NULLPOINTER;
-		errorLog("LevelOne::findLevelBackground2"); // technique 32
-	} else {
-		errorCode = FunctionStatusLevelOne::SUCCESS;
-	}
-	if(mLevelBackground3 == NULL) {
-		errorCode = FunctionStatusLevelOne::NULLPOINTER;
-		errorLog("LevelOne::findLevelBackground3"); // technique 32
+
+	if (mEndless) {
+		// The backgrounds loop on a game object of their own, drawn behind the obstacles.
+		mBackground = mArena.create<engine::GameObject>("background", LEVEL_START_POSITION);
+		this->addGameObject(*mBackground);
 	} else {
-		errorCode = FunctionStatusLevelOne::SUCCESS;
+		//Nothing to do. The backgrounds scroll with the level.
 	}
-	if(mAudioController == NULL) {
-    errorCode = FunctionStatusLevelOne::NULLPOINTER;
-    errorLog("LevelOne::findAudioController"); // technique 32
-  } else {
-    errorCode = FunctionStatusLevelOne::SUCCESS;
-  }
-	if(mLevelTheme == NULL) {
-    errorCode = FunctionStatusLevelOne::NULLPOINTER;
-    errorLog("LevelOne::findLevelTheme"); // technique 32
-  } else {
-    errorCode = FunctionStatusLevelOne::SUCCESS;
-  }
-	//instantiates level one ground
-	DEBUG("Creating ground."); //technique 29
-	mGround = new Obstacle("ground", std::make_pair(0, 404.5), ObstacleType::GROUND);
-	this->addGameObject(*mGround);
-
-	//from here, all block instantiates the level game objects in order
-	DEBUG("Creating obstacle car 1."); //technique 29
-	mObstacleCar1 = new Obstacle("obstacle_car_1", std::make_pair(1135, 300), ObstacleType::WESTERN_CAR);
-	this->addGameObject(*mObstacleCar1);
-
-	DEBUG("Creating spike 1."); //technique 29
-	mSpike1 = new Obstacle("obstacle_spike_1", std::make_pair(1349, 340), ObstacleType::WESTERN_SPIKE);
-	this->addGameObject(*mSpike1);
-
-	DEBUG("Creating obstacle box 0_1."); //technique 29
-	mObstacleBox01 = new Obstacle("obstacle_box_0_1", std::make_pair(1309, 310), ObstacleType::WESTERN_BOX);
-	this->addGameObject(*mObstacleBox01);
-
-	DEBUG("Creating obstacle aerial 1 - box."); //technique 29
-	mObstacleAerial1 = new Obstacle("obstacle_aerial_1", std::make_pair(1350, 250), ObstacleType::WESTERN_RAISED_BOX);
-	this->addGameObject(*mObstacleAerial1);
-
-	DEBUG("Creating part 1."); //technique 29
-	mPart1 = new Obstacle("part_1", std::make_pair(1500, 80), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart1);
-
-	DEBUG("Creating obstacle aerial 2 - post."); //technique 29
-	mObstacleAerial2 = new Obstacle("obstacle_aerial_2", std::make_pair(1755, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial2);
-
-	DEBUG("Creating part 1_1."); //technique 29
-	mPart1_1 = new Obstacle("part_1_1", std::make_pair(1890, 370), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart1_1);
-
-	DEBUG("Creating obstacle aerial 3 - post."); //technique 29
-	mObstacleAerial3 = new Obstacle("obstacle_aerial_3", std::make_pair(2030, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial3);
-
-	DEBUG("Creating part 2."); //technique 29
-	mPart2 = new Obstacle("part_2", std::make_pair(2225, 200), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart2);
-
-	DEBUG("Creating obstacle box 1."); //technique 29
-	mObstacleBox1 = new Obstacle("obstacle_box_1", std::make_pair(2225, 300), ObstacleType::WESTERN_BOX);
-	this->addGameObject(*mObstacleBox1);
-
-	DEBUG("Creating obstacle box 2."); //technique 29
-	mObstacleBox2 = new Obstacle("obstacle_box_2", std::make_pair(2645, 300), ObstacleType::WESTERN_BOX);
-	this->addGameObject(*mObstacleBox2);
-
-	DEBUG("Creating obstacle box 2_1."); //technique 29
-	mObstacleBox21 = new Obstacle("obstacle_box_2_1", std::make_pair(2779, 300), ObstacleType::WESTERN_BOX);
-	this->addGameObject(*mObstacleBox21);
-
-	DEBUG("Creating obstacle aerial 4 - box."); //technique 29
-	mObstacleAerial4 = new Obstacle("obstacle_aerial_4", std::make_pair(2820, 240), ObstacleType::WESTERN_RAISED_BOX);
-	this->addGameObject(*mObstacleAerial4);
-
-	DEBUG("Creating part 3."); //technique 29
-	mPart3 = new Obstacle("part_3", std::make_pair(2975, 310), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart3);
-
-	DEBUG("Creating obstacle car 2."); //technique 29
-	mObstacleCar2 = new Obstacle("obstacle_car_2", std::make_pair(3040, 300), ObstacleType::WESTERN_CAR);
-	this->addGameObject(*mObstacleCar2);
-
-	DEBUG("Creating part 4."); //technique 29
-	mPart4 = new Obstacle("part_4", std::make_pair(3285, 100), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart4);
-
-	DEBUG("Creating obstacle aerial 5 - post."); //technique 29
-	mObstacleAerial5 = new Obstacle("obstacle_aerial_5", std::make_pair(3510, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial5);
-
-	DEBUG("Creating part 4_1."); //technique 29
-	mPart41 = new Obstacle("part_4_1", std::make_pair(3655, 370), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart41);
-
-	DEBUG("Creating obstacle aerial 6 - post."); //technique 29
-	mObstacleAerial6 = new Obstacle("obstacle_aerial_6", std::make_pair(3675, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial6);
-
-	DEBUG("Creating part 5."); //technique 29
-	mPart5 = new Obstacle("part_5", std::make_pair(3975, 200), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart5);
-
-	DEBUG("Creating obstacle box 3."); //technique 29
-	mObstacleBox3 = new Obstacle("obstacle_box_3", std::make_pair(3975, 300), ObstacleType::WESTERN_BOX);
-	this->addGameObject(*mObstacleBox3);
-
-	DEBUG("Creating obstacle rock 1"); //technique 29
-	mObstacleRock1 = new Obstacle("obstacle_rock_1", std::make_pair(4300, 340), ObstacleType::WESTERN_ROCK);
-	this->addGameObject(*mObstacleRock1);
-
-	DEBUG("Creating part 6."); //technique 29
-	mPart6 = new Obstacle("part_6", std::make_pair(4460, 350), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart6);
-
-	DEBUG("Creating obstacle aerial 7 - post."); //technique 29
-	mObstacleAerial7 = new Obstacle("obstacle_aerial_7", std::make_pair(4660, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial7);
-
-	DEBUG("Creating obstacle rock 2"); //technique 29
-	mObstacleRock2 = new Obstacle("obstacle_rock_2", std::make_pair(4855, 340), ObstacleType::WESTERN_ROCK);
-	this->addGameObject(*mObstacleRock2);
-
-	DEBUG("Creating part 7."); //technique 29
-	mPart7 = new Obstacle("part_7", std::make_pair(5015, 350), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart7);
-
-	DEBUG("Creating obstacle aerial 8 - post."); //technique 29
-	mObstacleAerial8 = new Obstacle("obstacle_aerial_8", std::make_pair(5215, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial8);
-
-	DEBUG("Creating part 7_1."); //technique 29
-	mPart7_1 = new Obstacle("part_7_1", std::make_pair(5360, 370), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart7_1);
-
-	DEBUG("Creating obstacle aerial 9 - post."); //technique 29
-	mObstacleAerial9 = new Obstacle("obstacle_aerial_9", std::make_pair(5380, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial9);
-
-	DEBUG("Creating part 8."); //technique 29
-	mPart8 = new Obstacle("part_8", std::make_pair(5570, 200), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart8);
-
-	DEBUG("Creating part 9."); //technique 29
-	mPart9 = new Obstacle("part_9", std::make_pair(6100, 370), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart9);
-
-	DEBUG("Creating obstacle aerial 10 - post."); //technique 29
-	mObstacleAerial10 = new Obstacle("obstacle_aerial_10", std::make_pair(6150, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial10);
-
-	DEBUG("Creating part 10."); //technique 29
-	mPart10 = new Obstacle("part_10", std::make_pair(6340, 200), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart10);
-
-	DEBUG("Creating obstacle car 3."); //technique 29
-	mObstacleCar3 = new Obstacle("obstacle_car_3", std::make_pair(6700, 300), ObstacleType::WESTERN_CAR);
-	this->addGameObject(*mObstacleCar3);
-
-	DEBUG("Creating part 11."); //technique 29
-	mPart11 = new Obstacle("part_11", std::make_pair(6890, 80), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart11);
 
-	DEBUG("Creating obstacle aerial 11 - post."); //technique 29
-	mObstacleAerial11 = new Obstacle("obstacle_aerial_11", std::make_pair(7005, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial11);
+	std::pair<double, double> playerPosition = std::make_pair(0.0, 0.0);
+	bool loaded = mLevelData.load(mLevelPath);
 
-	DEBUG("Creating part 12."); //technique 29
-	mPart12 = new Obstacle("part_12", std::make_pair(7160, 370), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart12);
-
-	DEBUG("Creating obstacle aerial 12 - post."); //technique 29
-	mObstacleAerial12 = new Obstacle("obstacle_aerial_12", std::make_pair(7180, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial12);
-
-	DEBUG("Creating part 13."); //technique 29
-	mPart13 = new Obstacle("part_13", std::make_pair(7540, 220), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart13);
-
-	DEBUG("Creating part 14."); //technique 29
-	mPart14 = new Obstacle("part_14", std::make_pair(7830, 220), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart14);
-
-	DEBUG("Creating part 15."); //technique 29
-	mPart15 = new Obstacle("part_15", std::make_pair(8040, 220), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart15);
-
-	DEBUG("Creating part 16."); //technique 29
-	mPart16 = new Obstacle("part_16", std::make_pair(8390, 200), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart16);
-
-	DEBUG("Creating obstacle aerial 13 - post."); //technique 29
-	mObstacleAerial13 = new Obstacle("obstacle_aerial_13", std::make_pair(8570, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial13);
-
-	DEBUG("Creating spike 2."); //technique 29
-	mSpike2 = new Obstacle("obstacle_spike_2", std::make_pair(8880, 330), ObstacleType::WESTERN_SPIKE);
-	this->addGameObject(*mSpike2);
-
-	DEBUG("Creating obstacle box 4."); //technique 29
-	mObstacleBox4 = new Obstacle("obstacle_box_4", std::make_pair(8820, 300), ObstacleType::WESTERN_BOX);
-	this->addGameObject(*mObstacleBox4);
-
-	DEBUG("Creating spike 3."); //technique 29
-	mSpike3 = new Obstacle("obstacle_spike_3", std::make_pair(9120, 330), ObstacleType::WESTERN_SPIKE);
-	this->addGameObject(*mSpike3);
-
-	DEBUG("Creating obstacle box 5."); //technique 29
-	mObstacleBox5 = new Obstacle("obstacle_box_5", std::make_pair(9117, 300), ObstacleType::WESTERN_RAISED_BOX);
-	this->addGameObject(*mObstacleBox5);
-
-	DEBUG("Creating spike 4."); //technique 29
-	mSpike4 = new Obstacle("obstacle_spike_4", std::make_pair(9360, 330), ObstacleType::WESTERN_SPIKE);
-	this->addGameObject(*mSpike4);
-
-	DEBUG("Creating obstacle box 6."); //technique 29
-	mObstacleBox6 = new Obstacle("obstacle_box_6", std::make_pair(9358, 300), ObstacleType::WESTERN_RAISED_BOX);
-	this->addGameObject(*mObstacleBox6);
+	if (loaded) {
+		playerPosition = std::make_pair(mLevelData.getHeader().playerX, mLevelData.getHeader().playerY);
+	} else {
+		errorCode = FunctionStatusLevelOne::NOMATCHINGFILE;
+		errorLog("LevelOne::createGameObjects"); // technique 32
+		ERROR("Can't load the level " << mLevelPath);
+	}
 
-	DEBUG("Creating obstacle aerial 14 - box."); //technique 29
-	mObstacleAerial14 = new Obstacle("obstacle_aerial_14", std::make_pair(9358, 240), ObstacleType::WESTERN_RAISED_BOX);
-	this->addGameObject(*mObstacleAerial14);
+	//instantiates player at level one, it's added after the obstacles to be drawn over them
+	DEBUG("Creating Player."); //technique 29
+	mPlayer = mArena.create<Player>("player", playerPosition, mArena);
 
-	DEBUG("Creating obstacle box 7."); //technique 29
-	mObstacleBox7 = new Obstacle("obstacle_box_7", std::make_pair(9599, 300), ObstacleType::WESTERN_RAISED_BOX);
-	this->addGameObject(*mObstacleBox7);
+	if (loaded) {
+		createLevelComponents();
 
-	DEBUG("Creating obstacle aerial 15 - box."); //technique 29
-	mObstacleAerial15 = new Obstacle("obstacle_aerial_15", std::make_pair(9599, 240), ObstacleType::WESTERN_RAISED_BOX);
-	this->addGameObject(*mObstacleAerial15);
+		if (mEndless) {
+			createGenerator();
+		} else {
+			createObstacles();
+		}
 
-	DEBUG("Creating part 17."); //technique 29
-	mPart17 = new Obstacle("part_17", std::make_pair(9770, 350), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart17);
+		createChunkSlots();
+	} else {
+		//Nothing to do. The level has no obstacles.
+	}
 
-	DEBUG("Creating obstacle rock 3"); //technique 29
-	mObstacleRock3 = new Obstacle("obstacle_rock_3", std::make_pair(10070, 340), ObstacleType::WESTERN_ROCK);
-	this->addGameObject(*mObstacleRock3);
+	this->addGameObject(*mPlayer);
+	createEndingScreen();
+	addLevelParents();
 
-	DEBUG("Creating obstacle box 8."); //technique 29
-	mObstacleBox8 = new Obstacle("obstacle_box_8", std::make_pair(10480, 310), ObstacleType::WESTERN_BOX);
-	this->addGameObject(*mObstacleBox8);
+	mLevelCode = mArena.create<LevelOneCode>(*mLevelOne, mStreamer, sceneName);
+	mLevelOne->addComponent(*mLevelCode);
 
-	DEBUG("Creating part 18."); //technique 29
-	mPart18 = new Obstacle("part_18", std::make_pair(10560, 200), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart18);
+	if (mEndless && loaded) {
+		const LevelHeader &header = mLevelData.getHeader();
+		ASSERT(header.backgroundCount > 1, "Endless levels need a background to loop to.");
+		// The last background repeats the first one, the backgrounds loop where it starts.
+		mLevelCode->setEndless(*mBackground, mLevelData.getBackground(header.backgroundCount - 1).x);
+	} else {
+		//Nothing to do. The level ends.
+	}
 
-	DEBUG("Creating obstacle aerial 16 - post."); //technique 29
-	mObstacleAerial16 = new Obstacle("obstacle_aerial_16", std::make_pair(10730, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial16);
+	DEBUG("Built LevelOne with " << mArena.getObjectCount() << " objects (" << mArena.getUsedSize() << " bytes).");
+}
 
-	DEBUG("Creating obstacle rock 4"); //technique 29
-	mObstacleRock4 = new Obstacle("obstacle_rock_4", std::make_pair(10930, 340), ObstacleType::WESTERN_ROCK);
-	this->addGameObject(*mObstacleRock4);
+//function that adds the backgrounds and the audio of the level file to the level game object
+void LevelOne::createLevelComponents() {
+	const LevelHeader &header = mLevelData.getHeader();
+	engine::GameObject *backgroundObject = mEndless ? mBackground : mLevelOne;
+
+	for (unsigned int index = 0; index < header.backgroundCount; index++) {
+		const LevelBackground &background = mLevelData.getBackground(index);
+		engine::ImageComponent *image = mArena.create<engine::ImageComponent>(
+			*backgroundObject, mLevelData.getString(background.path), 1.0, std::make_pair(background.x, background.y)
+		);
+		backgroundObject->addComponent(*image);
+	}
 
-	DEBUG("Creating obstacle rock 5"); //technique 29
-	mObstacleRock5 = new Obstacle("obstacle_rock_5", std::make_pair(11180, 340), ObstacleType::WESTERN_ROCK);
-	this->addGameObject(*mObstacleRock5);
+	mAudioController = mArena.create<engine::AudioController>();
 
-	DEBUG("Creating obstacle aerial 17 - post."); //technique 29
-	mObstacleAerial17 = new Obstacle("obstacle_aerial_17", std::make_pair(11465, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial17);
+	for (unsigned int index = 0; index < header.audioCount; index++) {
+		const LevelAudio &audio = mLevelData.getAudio(index);
+		engine::AudioComponent *audioComponent = mArena.create<engine::AudioComponent>(
+			*mLevelOne, mLevelData.getString(audio.path), audio.isMusic != 0, audio.playOnStart != 0
+		);
+		mAudioController->addAudio(mLevelData.getString(audio.name), *audioComponent);
+	}
 
-	DEBUG("Creating obstacle box 9."); //technique 29
-	mObstacleBox9 = new Obstacle("obstacle_box_9", std::make_pair(11850, 300), ObstacleType::WESTERN_BOX);
-	this->addGameObject(*mObstacleBox9);
+	mLevelOne->addComponent(*mAudioController);
+}
 
-	DEBUG("Creating obstacle box 10."); //technique 29
-	mObstacleBox10 = new Obstacle("obstacle_box_10", std::make_pair(11984, 300), ObstacleType::WESTERN_BOX);
-	this->addGameObject(*mObstacleBox10);
+//function that adds the obstacles wider than a chunk, and sorts the others by the chunk they start on
+void LevelOne::createObstacles() {
+	const LevelHeader &header = mLevelData.getHeader();
+	const unsigned int RESIDENT = static_cast<unsigned int>(-1);
+	std::vector<unsigned int> obstacleChunkList(header.obstacleCount, RESIDENT);
+	unsigned int chunkCount = 0;
+
+	for (unsigned int index = 0; index < header.obstacleCount; index++) {
+		const LevelObstacle &levelObstacle = mLevelData.getObstacle(index);
+		const LevelBlock *blockList = mLevelData.getBlocks(levelObstacle);
+		float width = 0.0f;
+
+		for (unsigned int block = 0; block < levelObstacle.blockCount; block++) {
+			width = std::max(width, blockList[block].x + blockList[block].width);
+		}
+
+		if (width > LEVEL_CHUNK_WIDTH) {
+			Obstacle *obstacle = createObstacle(mArena, levelObstacle);
+			obstacle->setParent(mLevelOne);
+			this->addGameObject(*obstacle);
+			mObstacleList.push_back(obstacle);
+		} else {
+			unsigned int chunk = mStreamer.getChunk(levelObstacle.x);
+			obstacleChunkList[index] = chunk;
+			chunkCount = std::max(chunkCount, chunk + 1);
+			mStreamedTypes |= 1u << levelObstacle.type;
+		}
+	}
 
-	DEBUG("Creating obstacle aerial 18 - box."); //technique 29
-	mObstacleAerial18 = new Obstacle("obstacle_aerial_18", std::make_pair(12025, 240), ObstacleType::WESTERN_RAISED_BOX);
-	this->addGameObject(*mObstacleAerial18);
+	mResidentObstacleCount = mObstacleList.size();
 
-	DEBUG("Creating part 19."); //technique 29
-	mPart19 = new Obstacle("part_19", std::make_pair(12180, 340), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart19);
+	// The obstacles of each chunk are kept together, in the order of the level file.
+	mChunkStartList.assign(chunkCount + 1, 0);
 
-	DEBUG("Creating obstacle aerial 19 - post."); //technique 29
-	mObstacleAerial19 = new Obstacle("obstacle_aerial_19", std::make_pair(12370, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial19);
+	for (auto chunk : obstacleChunkList) {
+		if (chunk != RESIDENT) {
+			mChunkStartList[chunk + 1]++;
+		} else {
+			//Nothing to do. The obstacle was already built.
+		}
+	}
 
-	DEBUG("Creating obstacle rock 6"); //technique 29
-	mObstacleRock6 = new Obstacle("obstacle_rock_6", std::make_pair(12600, 340), ObstacleType::WESTERN_ROCK);
-	this->addGameObject(*mObstacleRock6);
+	for (unsigned int chunk = 0; chunk < chunkCount; chunk++) {
+		mChunkCapacity = std::max(mChunkCapacity, mChunkStartList[chunk + 1]);
+		mChunkStartList[chunk + 1] += mChunkStartList[chunk];
+	}
 
-	DEBUG("Creating obstacle rock 7"); //technique 29
-	mObstacleRock7 = new Obstacle("obstacle_rock_7", std::make_pair(12850, 340), ObstacleType::WESTERN_ROCK);
-	this->addGameObject(*mObstacleRock7);
+	std::vector<unsigned int> nextPositionList(mChunkStartList.begin(), mChunkStartList.end() - 1);
+	mChunkObstacleList.resize(mChunkStartList[chunkCount]);
 
-	DEBUG("Creating obstacle rock 8"); //technique 29
-	mObstacleRock8 = new Obstacle("obstacle_rock_8", std::make_pair(13100, 340), ObstacleType::WESTERN_ROCK);
-	this->addGameObject(*mObstacleRock8);
+	for (unsigned int index = 0; index < header.obstacleCount; index++) {
+		if (obstacleChunkList[index] != RESIDENT) {
+			mChunkObstacleList[nextPositionList[obstacleChunkList[index]]++] = index;
+		} else {
+			//Nothing to do.
+		}
+	}
 
-	DEBUG("Creating obstacle car 4."); //technique 29
-	mObstacleCar4 = new Obstacle("obstacle_car_4", std::make_pair(13570, 300), ObstacleType::WESTERN_CAR);
-	this->addGameObject(*mObstacleCar4);
+	mStreamer.setChunkCount(chunkCount);
+}
 
-	DEBUG("Creating part 20."); //technique 29
-	mPart20 = new Obstacle("part_20", std::make_pair(13860, 70), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart20);
+//function that adds the generator of the endless level, which fits its obstacles to the jump of the player
+void LevelOne::createGenerator() {
+	mGenerator = mArena.create<LevelGenerator>(
+		mSeed, LEVEL_CHUNK_WIDTH, mPlayer->M_JUMPING_SPEED, mPlayer->M_GRAVITY, global::SCROLL_SPEED
+	);
+	mChunkCapacity = mGenerator->getMaxObstacles();
+	mStreamedTypes = mGenerator->getObstacleTypes();
+	mStreamer.setChunkCount(std::numeric_limits<unsigned int>::max());
+
+	// One ground under every chunk loaded, "loadChunk" keeps it there.
+	mGenerator->generateGround(
+		mStreamer.getMaxLoadedChunks(global::WINDOWN_WIDTH), mGeneratedObstacleList, mGeneratedBlockList
+	);
+	const LevelObstacle &ground = mGeneratedObstacleList[0];
+	mGround = mArena.create<Obstacle>(
+		"ground", std::make_pair(ground.x, ground.y), ObstacleType::GROUND, mGeneratedBlockList.data(), ground.blockCount,
+		mArena
+	);
+	mGround->setParent(mLevelOne);
+	this->addGameObject(*mGround);
+	mObstacleList.push_back(mGround);
+	mResidentObstacleCount = mObstacleList.size();
+}
 
-	DEBUG("Creating obstacle car 5."); //technique 29
-	mObstacleCar5 = new Obstacle("obstacle_car_5", std::make_pair(14200, 300), ObstacleType::WESTERN_CAR);
-	this->addGameObject(*mObstacleCar5);
+//function that reserves, between the level and the player, the scene slots of the chunks loaded at once
+void LevelOne::createChunkSlots() {
+	// Scenes start with the camera on the origin of their world. The chunks loaded there are never released, so
+	// the snapshot can be restored without building them again.
+	mStartChunkCount = mStreamer.getLoadedEnd(0.0, global::WINDOWN_WIDTH);
+	unsigned int streamedSlotCount = std::min(
+		mStreamer.getMaxLoadedChunks(global::WINDOWN_WIDTH), mStreamer.getChunkCount() - mStartChunkCount
+	);
+	unsigned int slotCount = mStartChunkCount + streamedSlotCount;
+
+	for (unsigned int slot = 0; slot < slotCount; slot++) {
+		mChunkArenaList.push_back(mArena.create<engine::Arena>(CHUNK_ARENA_CHUNK_SIZE));
+	}
 
-	DEBUG("Creating spike 5."); //technique 29
-	mSpike5 = new Obstacle("obstacle_spike_5", std::make_pair(14414, 340), ObstacleType::WESTERN_SPIKE);
-	this->addGameObject(*mSpike5);
+	mFirstChunkHandle = this->reserveGameObjects(slotCount * mChunkCapacity);
+	mObstacleList.resize(mResidentObstacleCount + slotCount * mChunkCapacity, NULL);
+	DEBUG("Level split in " << mStreamer.getChunkCount() << " chunks, " << mStartChunkCount << " kept from the start and "
+	      << streamedSlotCount << " streamed at once with up to " << mChunkCapacity << " obstacles.");
+}
 
-	DEBUG("Creating obstacle box 11."); //technique 29
-	mObstacleBox11 = new Obstacle("obstacle_box_11", std::make_pair(14374, 310), ObstacleType::WESTERN_BOX);
-	this->addGameObject(*mObstacleBox11);
+//function that gives the slot of a chunk, the chunks of the start have their own
+unsigned int LevelOne::findChunkSlot(unsigned int chunk) {
+	if (chunk < mStartChunkCount) {
+		return chunk;
+	} else {
+		ASSERT(mChunkArenaList.size() > mStartChunkCount, "The level has no slot for streamed chunks.");
+		return mStartChunkCount + chunk % (mChunkArenaList.size() - mStartChunkCount);
+	}
+}
 
-	DEBUG("Creating obstacle aerial 20 - box."); //technique 29
-	mObstacleAerial20 = new Obstacle("obstacle_aerial_20", std::make_pair(14415, 250), ObstacleType::WESTERN_RAISED_BOX);
-	this->addGameObject(*mObstacleAerial20);
+//function that builds an obstacle of the level file on an arena
+Obstacle *LevelOne::createObstacle(engine::Arena &arena, const LevelObstacle &levelObstacle) {
+	return arena.create<Obstacle>(
+		mLevelData.getString(levelObstacle.name),
+		std::make_pair(levelObstacle.x, levelObstacle.y),
+		static_cast<ObstacleType>(levelObstacle.type),
+		mLevelData.getBlocks(levelObstacle),
+		levelObstacle.blockCount,
+		arena
+	);
+}
 
-	DEBUG("Creating part 21."); //technique 29
-	mPart21 = new Obstacle("part_21", std::make_pair(14565, 80), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart21);
+//function that builds the obstacles of a chunk, on the slot the chunk gets
+void LevelOne::loadChunk(unsigned int chunk) {
+	unsigned int slot = findChunkSlot(chunk);
+	engine::Arena &chunkArena = *mChunkArenaList[slot];
+
+	if (chunk < mBuiltStartChunkCount) {
+		// A chunk of the start is still built, it's only shown again.
+		for (unsigned int index = 0; index < mChunkCapacity; index++) {
+			Obstacle *obstacle = mObstacleList[mResidentObstacleCount + slot * mChunkCapacity + index];
+
+			if (obstacle != NULL) {
+				obstacle->mObjectState = engine::ObjectState::ENABLED;
+			} else {
+				//Nothing to do. The chunk has fewer obstacles.
+			}
+		}
+	} else if (mGenerator != NULL) {
+		mGenerator->generateChunk(chunk, mGeneratedObstacleList, mGeneratedBlockList);
+		ASSERT(mGeneratedObstacleList.size() <= mChunkCapacity, "The chunk has more obstacles than slots.");
+
+		for (unsigned int index = 0; index < mGeneratedObstacleList.size(); index++) {
+			const LevelObstacle &levelObstacle = mGeneratedObstacleList[index];
+			Obstacle *obstacle = chunkArena.create<Obstacle>(
+				"chunk_" + std::to_string(chunk) + "_" + std::to_string(index),
+				std::make_pair(levelObstacle.x, levelObstacle.y),
+				static_cast<ObstacleType>(levelObstacle.type),
+				mGeneratedBlockList.data() + levelObstacle.firstBlock,
+				levelObstacle.blockCount,
+				chunkArena
+			);
+			placeObstacle(slot, index, *obstacle);
+		}
+
+		// The chunks load in order, the ground ends with the last one.
+		unsigned int loadedCount = mChunkArenaList.size() - mStartChunkCount;
+		unsigned int firstChunk = chunk + 1 - std::min<unsigned int>(chunk + 1, loadedCount);
+		mGround->setLocalPosition(std::make_pair(firstChunk * LEVEL_CHUNK_WIDTH, mGround->getLocalPosition().second));
+	} else {
+		unsigned int firstPosition = mChunkStartList[chunk];
+		unsigned int obstacleCount = mChunkStartList[chunk + 1] - firstPosition;
 
-	DEBUG("Creating obstacle aerial 21 - post."); //technique 29
-	mObstacleAerial21 = new Obstacle("obstacle_aerial_21", std::make_pair(14820, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial21);
+		for (unsigned int index = 0; index < obstacleCount; index++) {
+			const LevelObstacle &levelObstacle = mLevelData.getObstacle(mChunkObstacleList[firstPosition + index]);
+			placeObstacle(slot, index, *createObstacle(chunkArena, levelObstacle));
+		}
+	}
 
-	DEBUG("Creating obstacle rock 9"); //technique 29
-	mObstacleRock9 = new Obstacle("obstacle_rock_9", std::make_pair(15000, 340), ObstacleType::WESTERN_ROCK);
-	this->addGameObject(*mObstacleRock9);
+	if (chunk == mBuiltStartChunkCount && chunk < mStartChunkCount) {
+		mBuiltStartChunkCount++;
+	} else {
+		//Nothing to do. The chunk is streamed or was built before.
+	}
+}
 
-	DEBUG("Creating obstacle aerial 22 - post."); //technique 29
-	mObstacleAerial22 = new Obstacle("obstacle_aerial_22", std::make_pair(15300, 185), ObstacleType::WESTERN_POST);
-	this->addGameObject(*mObstacleAerial22);
+//function that places an obstacle on the level and inits it, then puts it on its chunk slot
+void LevelOne::placeObstacle(unsigned int slot, unsigned int index, Obstacle &obstacle) {
+	obstacle.setParent(mLevelOne);
+	obstacle.init();
 
-	DEBUG("Creating part 22."); //technique 29
-	mPart22 = new Obstacle("part_22", std::make_pair(15530, 140), ObstacleType::MACHINE_PART);
-	this->addGameObject(*mPart22);
-	//instantiates player at level one
-	DEBUG("Creating Player."); //technique 29
-	mPlayer = new Player("player", std::make_pair(165, 280));
-	this->addGameObject(*mPlayer);
+	this->placeGameObject(mFirstChunkHandle + slot * mChunkCapacity + index, obstacle);
+	mObstacleList[mResidentObstacleCount + slot * mChunkCapacity + index] = &obstacle;
+}
 
-	createEndingScreen();
-	addLevelParents();
+//function that shuts down the obstacles of a chunk and frees its slot
+void LevelOne::releaseChunk(unsigned int chunk) {
+	unsigned int slot = findChunkSlot(chunk);
+
+	for (unsigned int index = 0; index < mChunkCapacity; index++) {
+		Obstacle *&obstacle = mObstacleList[mResidentObstacleCount + slot * mChunkCapacity + index];
+
+		if (obstacle != NULL && chunk < mStartChunkCount) {
+			// The chunks of the start stay built for the snapshot, disabled they're not drawn, updated or collided.
+			obstacle->mObjectState = engine::ObjectState::DISABLED;
+		} else if (obstacle != NULL) {
+			obstacle->shutdown();
+			this->removeGameObject(mFirstChunkHandle + slot * mChunkCapacity + index);
+			obstacle = NULL;
+		} else {
+			//Nothing to do. The chunk has fewer obstacles.
+		}
+	}
 
-	mLevelCode = new LevelOneCode(*mLevelOne);
-	mLevelOne->addComponent(*mLevelCode);
+	if (chunk < mStartChunkCount) {
+		//Nothing to do. The snapshot puts the chunk back as it started.
+	} else {
+		// A released chunk loses its state, level one only scrolls forward.
+		mChunkArenaList[slot]->reset();
+	}
 }
 
 //function that instantiate game over screen/menu
 void LevelOne::createEndingScreen() {
-	mWinningScreenObject = new engine::GameObject("winning_screen", std::make_pair(0, 0));
+	mWinningScreenObject = mArena.create<engine::GameObject>("winning_screen", std::make_pair(0.0, 0.0));
 	mWinningScreenObject->mObjectState = engine::ObjectState::DISABLED;
-	mWinningScreen = new engine::BackgroundComponent(*mWinningScreenObject, "general_images/tela_vitoria.png");
+	mWinningScreen = mArena.create<engine::BackgroundComponent>(*mWinningScreenObject, "general_images/tela_vitoria.png");
 	mWinningScreenObject->addComponent(*mWinningScreen);
 	this->addGameObject(*mWinningScreenObject);
 
-	mLosingPartsScreenObject = new engine::GameObject("losing_parts", std::make_pair(0, 0));
+	mLosingPartsScreenObject = mArena.create<engine::GameObject>("losing_parts", std::make_pair(0.0, 0.0));
 	mLosingPartsScreenObject->mObjectState = engine::ObjectState::DISABLED;
-	mLosingPartsScreen = new engine::BackgroundComponent(*mLosingPartsScreenObject, "general_images/tela_derrota.png");
+	mLosingPartsScreen = mArena.create<engine::BackgroundComponent>(*mLosingPartsScreenObject, "general_images/tela_derrota.png");
 	mLosingPartsScreenObject->addComponent(*mLosingPartsScreen);
 	this->addGameObject(*mLosingPartsScreenObject);
 
-	mLosingDeathScreenObject = new engine::GameObject("losing_death", std::make_pair(0, 0));
+	mLosingDeathScreenObject = mArena.create<engine::GameObject>("losing_death", std::make_pair(0.0, 0.0));
 	mLosingDeathScreenObject->mObjectState = engine::ObjectState::DISABLED;
-	mLosingDeathScreen = new engine::BackgroundComponent(*mLosingDeathScreenObject, "general_images/tela_morte.png");
+	mLosingDeathScreen = mArena.create<engine::BackgroundComponent>(*mLosingDeathScreenObject, "general_images/tela_morte.png");
 	mLosingDeathScreenObject->addComponent(*mLosingDeathScreen);
 	this->addGameObject(*mLosingDeathScreenObject);
 
-	mArrow = new engine::GameObject("arrow", std::make_pair(0, 0));
+	mArrow = mArena.create<engine::GameObject>("arrow", std::make_pair(0.0, 0.0));
 	mArrow->mObjectState = engine::ObjectState::DISABLED;
-	mArrowImage = new engine::ImageComponent(*mArrow, "general_images/arrow.png", 1);
+	// The arrow points at the options of the screens, which don't scroll.
+	mArrow->mFixedOnScreen = true;
+	mArrowImage = mArena.create<engine::ImageComponent>(*mArrow, "general_images/arrow.png", 1.0);
 	mArrow->addComponent(*mArrowImage);
 	this->addGameObject(*mArrow);
 }
 
-//function that adds level one parents
+//function that adds the level one parents
 void LevelOne::addLevelParents() {
 	DEBUG("adding level parents."); //technique 29
-	mLevelOne->mParentList.push_back(mObstacleCar1);
-	mLevelOne->mParentList.push_back(mObstacleAerial1);
-	mLevelOne->mParentList.push_back(mObstacleBox01);
-	mLevelOne->mParentList.push_back(mSpike1);
-	mLevelOne->mParentList.push_back(mPart1);
-	mLevelOne->mParentList.push_back(mObstacleAerial2);
-	mLevelOne->mParentList.push_back(mPart1_1);
-	mLevelOne->mParentList.push_back(mObstacleAerial3);
-	mLevelOne->mParentList.push_back(mPart2);
-	mLevelOne->mParentList.push_back(mObstacleBox1);
-	mLevelOne->mParentList.push_back(mObstacleBox2);
-	mLevelOne->mParentList.push_back(mObstacleAerial4);
-	mLevelOne->mParentList.push_back(mObstacleBox21);
-	mLevelOne->mParentList.push_back(mPart3);
-	mLevelOne->mParentList.push_back(mObstacleCar2);
-	mLevelOne->mParentList.push_back(mPart4);
-	mLevelOne->mParentList.push_back(mObstacleAerial5);
-	mLevelOne->mParentList.push_back(mPart41);
-	mLevelOne->mParentList.push_back(mObstacleAerial6);
-	mLevelOne->mParentList.push_back(mPart5);
-	mLevelOne->mParentList.push_back(mObstacleBox3);
-	mLevelOne->mParentList.push_back(mObstacleRock1);
-	mLevelOne->mParentList.push_back(mPart6);
-	mLevelOne->mParentList.push_back(mObstacleAerial7);
-	mLevelOne->mParentList.push_back(mObstacleRock2);
-	mLevelOne->mParentList.push_back(mPart7);
-	mLevelOne->mParentList.push_back(mObstacleAerial8);
-	mLevelOne->mParentList.push_back(mPart7_1);
-	mLevelOne->mParentList.push_back(mObstacleAerial9);
-	mLevelOne->mParentList.push_back(mPart8);
-	mLevelOne->mParentList.push_back(mPart9);
-	mLevelOne->mParentList.push_back(mObstacleAerial10);
-	mLevelOne->mParentList.push_back(mPart10);
-	mLevelOne->mParentList.push_back(mObstacleCar3);
-	mLevelOne->mParentList.push_back(mPart11);
-	mLevelOne->mParentList.push_back(mObstacleAerial11);
-	mLevelOne->mParentList.push_back(mPart12);
-	mLevelOne->mParentList.push_back(mObstacleAerial12);
-	mLevelOne->mParentList.push_back(mPart13);
-	mLevelOne->mParentList.push_back(mPart14);
-	mLevelOne->mParentList.push_back(mPart15);
-	mLevelOne->mParentList.push_back(mPart16);
-	mLevelOne->mParentList.push_back(mObstacleAerial13);
-	mLevelOne->mParentList.push_back(mSpike2);
-	mLevelOne->mParentList.push_back(mObstacleBox4);
-	mLevelOne->mParentList.push_back(mSpike3);
-	mLevelOne->mParentList.push_back(mObstacleBox5);
-	mLevelOne->mParentList.push_back(mSpike4);
-	mLevelOne->mParentList.push_back(mObstacleBox6);
-	mLevelOne->mParentList.push_back(mObstacleAerial14);
-	mLevelOne->mParentList.push_back(mObstacleBox7);
-	mLevelOne->mParentList.push_back(mObstacleAerial15);
-	mLevelOne->mParentList.push_back(mPart17);
-	mLevelOne->mParentList.push_back(mObstacleRock3);
-	mLevelOne->mParentList.push_back(mObstacleBox8);
-	mLevelOne->mParentList.push_back(mPart18);
-	mLevelOne->mParentList.push_back(mObstacleAerial16);
-	mLevelOne->mParentList.push_back(mObstacleRock4);
-	mLevelOne->mParentList.push_back(mObstacleRock5);
-	mLevelOne->mParentList.push_back(mObstacleAerial17);
-	mLevelOne->mParentList.push_back(mObstacleBox9);
-	mLevelOne->mParentList.push_back(mObstacleBox10);
-	mLevelOne->mParentList.push_back(mObstacleAerial18);
-	mLevelOne->mParentList.push_back(mPart19);
-	mLevelOne->mParentList.push_back(mObstacleAerial19);
-	mLevelOne->mParentList.push_back(mObstacleRock6);
-	mLevelOne->mParentList.push_back(mObstacleRock7);
-	mLevelOne->mParentList.push_back(mObstacleRock8);
-	mLevelOne->mParentList.push_back(mObstacleCar4);
-	mLevelOne->mParentList.push_back(mPart20);
-	mLevelOne->mParentList.push_back(mObstacleCar5);
-	mLevelOne->mParentList.push_back(mObstacleAerial20);
-	mLevelOne->mParentList.push_back(mObstacleBox11);
-	mLevelOne->mParentList.push_back(mSpike5);
-	mLevelOne->mParentList.push_back(mPart21);
-	mLevelOne->mParentList.push_back(mObstacleAerial21);
-	mLevelOne->mParentList.push_back(mObstacleRock9);
-	mLevelOne->mParentList.push_back(mObstacleAerial22);
-	mLevelOne->mParentList.push_back(mPart22);
-
 	mLevelOne->mParentList.push_back(mWinningScreenObject);
 	mLevelOne->mParentList.push_back(mLosingPartsScreenObject);
 	mLevelOne->mParentList.push_back(mLosingDeathScreenObject);
 	mLevelOne->mParentList.push_back(mArrow);
-
 	mLevelOne->mParentList.push_back(mPlayer);
-	mLevelOne->mParentList.push_back(mGround);
 }
 
 void LevelOne::errorLog(std::string file){ // technique 32
@@ -551,6 +495,9 @@ void LevelOne::errorLog(std::string file){ // technique 32
             break;
         case FunctionStatusLevelOne::NULLPOINTER:
             message += "null pointer\n";
+            break;
+        case FunctionStatusLevelOne::NOMATCHINGFILE:
+            message += "no matching file\n";
             break;
     		case FunctionStatusLevelOne::WRONGTYPE:
             message += "wrong type\n";
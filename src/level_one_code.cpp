@@ -10,42 +10,78 @@
 */
 
 #include "level_one_code.hpp"
+#include <cmath>
 
 using namespace Azo;
 
 /*
  * @brief Standard LevelOneCode constructor
  * 
- * Creates LeveloneCode instance.
+ * Creates LeveloneCode instance. The obstacles aren't parents of the level,
+ * the level builds them as the streamer loads their chunks, and places them
+ * on it so they scroll along.
  */
-LevelOneCode::LevelOneCode(engine::GameObject &gameObject){
+LevelOneCode::LevelOneCode(engine::GameObject &gameObject, engine::LevelStreamer &streamer, std::string sceneName) {
 	ASSERT(&gameObject != NULL, "The game object can't be null.");
+	ASSERT(sceneName != "", "The scene name can't be blank.");
 	this->gameObject = &gameObject;
+	mStreamer = &streamer;
+	mSceneName = sceneName;
 	getParents();
-	findAudioController();
+	mAudioController = gameObject.getComponent<engine::AudioController>();
+}
+
+
+/*
+ * @brief Makes the level endless.
+ * 
+ * The level scrolls for as long as the player lives, and the background
+ * goes back by loopWidth each time the level scrolls that much.
+ */
+void LevelOneCode::setEndless(engine::GameObject &background, double loopWidth) {
+	ASSERT(loopWidth > 0.0, "The loop width must be positive.");
+	mEndless = true;
+	mBackground = &background;
+	mBackgroundLoopWidth = loopWidth;
 }
 
 
 /*
  * @brief Shutdown LevelOneCode component.
  * 
- * Iterates through each created obstacle and the audioController, then deletes them.
+ * Forgets the streamer and the audioController, the level deletes them.
  */
 void LevelOneCode::shutdown() {
-	for (auto Obstacle : mObstacleList) 
-		Obstacle = nullptr;
-		mAudioController = nullptr;
-		mPlayer = nullptr;
-	}
+	mStreamer = nullptr;
+	mAudioController = nullptr;
+	mPlayer = nullptr;
+}
+
+
+/*
+ * @brief Writes the LevelOneCode state.
+ * 
+ * The obstacles belong to the level, which loads them again before restoring.
+ * The camera scrolls the level, so it's written with it.
+ */
+void LevelOneCode::saveState(engine::StateBuffer &stateBuffer) {
+	engine::Component::saveState(stateBuffer);
+	stateBuffer.write(mWaitingTime);
+	stateBuffer.write(mCurrentOption);
+	engine::Game::instance.getCamera().saveState(stateBuffer);
+}
 
 
 /*
- * @brief Locates audio controller.
+ * @brief Reads back the LevelOneCode state.
  * 
- * Finds the current audio controller and sets it to level.
+ * Reads in the same order as saveState.
  */
-void LevelOneCode::findAudioController() {
-	mAudioController = (gameObject->getAudioController(typeid(engine::AudioController)));
+void LevelOneCode::loadState(engine::StateBuffer &stateBuffer) {
+	engine::Component::loadState(stateBuffer);
+	stateBuffer.read(mWaitingTime);
+	stateBuffer.read(mCurrentOption);
+	engine::Game::instance.getCamera().loadState(stateBuffer);
 }
 
 
@@ -60,8 +96,6 @@ void LevelOneCode::getParents() {
 	for (auto parent : gameObject->mParentList) {
 		if (parent->getClassName() == "Player") {
 			mPlayer = dynamic_cast<Player *>(parent);
-		} else if (parent->getClassName() == "obstacle") {
-			mObstacleList.push_back(dynamic_cast<Obstacle *>(parent));
 		} else if (parent->mName == "winning_screen") {
 			mWinningScreen = parent;
 		} else if (parent->mName == "losing_parts") {
@@ -82,20 +116,65 @@ void LevelOneCode::getParents() {
  * @brief Updates LevelOneCode state.
  * 
  * Checks the level state and makes changes to position, sound and game state accordingly.
+ * The physics world found the player contacts before this update, so the
+ * level only scrolls after the player moved.
  */
 void LevelOneCode::updateCode() {
-	//DEBUG("Position: " << gameObject->mCurrentPosition.first );
+	// If player isn't dead, update player physics.
+	if (mPlayer->mState != PlayerState::DIE) {
+		updatePhysics();
+	} else {
+		mWaitingTime += engine::Game::instance.getTimer().getDeltaTime();
+
+		if (mWaitingTime >= 2300.0) { 
+			mLosingDeath->mObjectState = engine::ObjectState::ENABLED;
+			changeOption();
+			if (engine::Game::instance.inputManager.keyDownOnce(engine::Button::ENTER)){
+				chooseOption();
+			}
+			else {
+				//Nothing to do.
+			}
+		}
+		else {
+			//Nothing to do.
+		}
+
+		if (mAudioController->getAudioState("tema_level_one") == engine::AudioState::PLAYING){
+			mAudioController->stopAudio("tema_level_one");
+		}
+		else {
+			//Nothing to do.
+		}
+	}
+
+	updateScrolling();
+	updateBackground();
+	// Only the chunks around the camera stay loaded.
+	mStreamer->update(engine::Game::instance.getCamera().getPosition().first, global::WINDOWN_WIDTH);
+}
+
+
+/*
+ * @brief Scrolls the level.
+ * 
+ * Moves the camera along the level while the player walks, keeping the
+ * player at the same place on the screen, and handles the end of the level.
+ */
+void LevelOneCode::updateScrolling() {
 	//DEBUG("Collected parts: " << mPlayer->mCollectedParts);
 	const double PLAYER_MAX_POSITION = 300.0; 
-	const int GAME_OBJECT_MAX_POSITION = -17600; 
-
-	// Checking player and game object's position on update.
-	if (mPlayer->mCurrentPosition.first >= PLAYER_MAX_POSITION && gameObject->mCurrentPosition.first > GAME_OBJECT_MAX_POSITION) {
-		const double CONTROLLER_POSITION_GAME_OBJECT = 4.0; 
-		gameObject->mCurrentPosition.first -= CONTROLLER_POSITION_GAME_OBJECT;
+	const int CAMERA_MAX_POSITION = 17600; 
+	engine::Camera &camera = engine::Game::instance.getCamera();
+	double playerScreenPosition = mPlayer->mCurrentPosition.first - camera.getPosition().first;
+
+	// Checking player and camera's position on update.
+	if (playerScreenPosition >= PLAYER_MAX_POSITION &&
+	    (mEndless || camera.getPosition().first < CAMERA_MAX_POSITION)) {
+		camera.move(global::SCROLL_SPEED * engine::Game::instance.getTimer().getDeltaTime(), 0.0);
 		const int CONTROLLER_POSITION_PLAYER = 299; 
-		mPlayer->mCurrentPosition.first = CONTROLLER_POSITION_PLAYER;
-	} else if (mPlayer->mCurrentPosition.first >= PLAYER_MAX_POSITION) { 
+		mPlayer->mCurrentPosition.first = camera.getPosition().first + CONTROLLER_POSITION_PLAYER;
+	} else if (playerScreenPosition >= PLAYER_MAX_POSITION) { 
 		// Triggers once max distance on level is reached, causing the game to end.
 		mWaitingTime += engine::Game::instance.getTimer().getDeltaTime();
 		mPlayer->mSpeed.first = 0.0; 
@@ -146,34 +225,23 @@ void LevelOneCode::updateCode() {
 	else {
 		//Nothing to do.
 	}
-	updateObstaclePosition();
-
-	// If player isn't dead, update player physics.
-	if (mPlayer->mState != PlayerState::DIE) {
-		updatePhysics();
-	} else {
-		mWaitingTime += engine::Game::instance.getTimer().getDeltaTime();
+}
 
-		if (mWaitingTime >= 2300.0) { 
-			mLosingDeath->mObjectState = engine::ObjectState::ENABLED;
-			changeOption();
-			if (engine::Game::instance.inputManager.keyDownOnce(engine::Button::ENTER)){
-				chooseOption();
-			}
-			else {
-				//Nothing to do.
-			}
-		}
-		else {
-			//Nothing to do.
-		}
 
-		if (mAudioController->getAudioState("tema_level_one") == engine::AudioState::PLAYING){
-			mAudioController->stopAudio("tema_level_one");
-		}
-		else {
-			//Nothing to do.
-		}
+/*
+ * @brief Loops the background of an endless level.
+ * 
+ * The background goes to the last loop that starts before the camera, on
+ * both positions, so drawing between them doesn't show the jump forward.
+ */
+void LevelOneCode::updateBackground() {
+	if (mEndless) {
+		double cameraPosition = engine::Game::instance.getCamera().getPosition().first;
+		double loopStart = cameraPosition + std::fmod(-cameraPosition, mBackgroundLoopWidth);
+		mBackground->mCurrentPosition.first = loopStart;
+		mBackground->mPreviousPosition.first = loopStart;
+	} else {
+		//Nothing to do. The backgrounds of the level scroll with it.
 	}
 }
 
@@ -220,7 +288,7 @@ void LevelOneCode::chooseOption() {
 	switch(mCurrentOption){
 		case 1:
 			mAudioController->stopAllAudios();
-			engine::Game::instance.changeScene("level_one");
+			engine::Game::instance.changeScene(mSceneName);
 			break;
 		case 2:
 			engine::Game::instance.changeScene("menu");
@@ -229,44 +297,19 @@ void LevelOneCode::chooseOption() {
 }
 
 
-/*
- * @brief Self-explanatory.
- * 
- * Iterates through each obstacle and updates its position.
- */
-void LevelOneCode::updateObstaclePosition() {
-	for (auto eachObstacle : mObstacleList) {
-		eachObstacle->mCurrentPosition.first = gameObject->mCurrentPosition.first + eachObstacle->mPositionRelativeToParent.first;
-		eachObstacle->mCurrentPosition.second = gameObject->mCurrentPosition.second + eachObstacle->mPositionRelativeToParent.second;
-
-		for (auto block : eachObstacle->mBlockList) {
-			block->mCurrentPosition.first = gameObject->mCurrentPosition.first + block->mPositionRelativeToParent.first;
-			block->mCurrentPosition.second = gameObject->mCurrentPosition.second + block->mPositionRelativeToParent.second;
-
-			block->mCenter.first = block->mCurrentPosition.first + block->mHalfSize.first;
-			block->mCenter.second = block->mCurrentPosition.second + block->mHalfSize.second;
-
-			// DEBUG("BLock current position in X: " << block->mCurrentPosition.first);
-			// DEBUG("BLock current position in Y: " << block->mCurrentPosition.second);
-			// DEBUG("Block center in X: " << block->mCenter.first);
-			// DEBUG("Block center in Y: " << block->mCenter.second);
-		}
-	}
-}
-
-
 /*
  * @brief Sets max position for player.
  * 
  * Automatically updates player's position in case it exceeds the limit.
  */
-void LevelOneCode::maxPosition(Player *mPlayer, engine::GameObject *gameObject){
+void LevelOneCode::maxPosition(Player *mPlayer){
 	const int PLAYER_MAX_POSITION_CANVAS = 300;
-	const int  GAME_OBJECT_MAX_POSITION_CANVAS = -7390;
+	const int CAMERA_MAX_POSITION_CANVAS = 7390;
+	double cameraPosition = engine::Game::instance.getCamera().getPosition().first;
 
-	if (mPlayer->mCurrentPosition.first >= PLAYER_MAX_POSITION_CANVAS &&
-		gameObject->mCurrentPosition.first > GAME_OBJECT_MAX_POSITION_CANVAS) {
-			mPlayer->mCurrentPosition.first = PLAYER_MAX_POSITION_CANVAS;
+	if (mPlayer->mCurrentPosition.first - cameraPosition >= PLAYER_MAX_POSITION_CANVAS &&
+		cameraPosition < CAMERA_MAX_POSITION_CANVAS) {
+			mPlayer->mCurrentPosition.first = cameraPosition + PLAYER_MAX_POSITION_CANVAS;
 	} else {
 			//Nothing to do.
 	}
@@ -280,9 +323,14 @@ void LevelOneCode::maxPosition(Player *mPlayer, engine::GameObject *gameObject){
  */
 void LevelOneCode::checkCollisions(Player *mPlayer){
 	double wallX = 0.0;
+	engine::ContactManifold &contactManifold = mPlayer->getCollider().getContactManifold();
+	engine::Contact &rightWall = contactManifold.rightWall;
+	engine::Contact &leftWall = contactManifold.leftWall;
+
 	//Check wall on right
-	if (mPlayer->mSpeed.first > 0 && hasWallOnRight(&wallX)) {
+	if (mPlayer->mSpeed.first > 0 && rightWall.object != NULL) {
 		DEBUG("Collision with the wall"); 
+		handleCollisionSide(static_cast<Obstacle *>(rightWall.object), mPlayer, &wallX, -1.0, rightWall.surface);
 		mPlayer->mCurrentPosition.first = wallX - (mPlayer->mHalfSize.first * 2);
 		mPlayer->mPushesLeftWall = true;
 		mPlayer->mState = PlayerState::DIE;
@@ -291,7 +339,8 @@ void LevelOneCode::checkCollisions(Player *mPlayer){
 	}
 
 	//Check wall on left
-	if (mPlayer->mSpeed.first < 0.0 && hasWallOnLeft(&wallX)) { 
+	if (mPlayer->mSpeed.first < 0.0 && leftWall.object != NULL) { 
+		handleCollisionSide(static_cast<Obstacle *>(leftWall.object), mPlayer, &wallX, +1.0, leftWall.surface);
 		mPlayer->mState = PlayerState::DIE;
 	} else {
 		mPlayer->mPushesRightWall = false;
@@ -308,11 +357,17 @@ void LevelOneCode::checkJumpSlide(Player *mPlayer){
 	mPlayer->mCurrentPosition.second += mPlayer->mSpeed.second * engine::Game::instance.getTimer().getDeltaTime();
 	double groundY = 0.0; 
 	const int PLAYER_RELATIVE_POSITION = 15;
+	engine::ContactManifold &contactManifold = mPlayer->getCollider().getContactManifold();
+	engine::Contact &ceiling = contactManifold.ceiling;
+	engine::Contact &ground = contactManifold.ground;
 
-	if (mPlayer->mSpeed.second < 0.0 && hasCeiling(&groundY)) { 
+	if (mPlayer->mSpeed.second < 0.0 && ceiling.object != NULL) { 
+		handleCollisionCeiling(static_cast<Obstacle *>(ceiling.object), mPlayer, &groundY, ceiling.surface);
 		mPlayer->mCurrentPosition.second = groundY + PLAYER_RELATIVE_POSITION;
 		mPlayer->mAtCeiling = true;
-	} else if ((mPlayer->mSpeed.second >= 0.0 || mPlayer->mState == PlayerState::SLIDE) && hasGround(&groundY)) { 
+	} else if ((mPlayer->mSpeed.second >= 0.0 || mPlayer->mState == PlayerState::SLIDE) && ground.object != NULL) { 
+		handleCollisionGround(static_cast<Obstacle *>(ground.object), mPlayer);
+		groundY = ground.surface;
 		mPlayer->mCurrentPosition.second = groundY - mPlayer->mHalfSize.second - mPlayer->mHalfSize.second + PLAYER_RELATIVE_POSITION;
 		mPlayer->mSpeed.second = mPlayer->M_ZERO_VECTOR.second;
 		mPlayer->mOnGround = true;
@@ -331,7 +386,7 @@ void LevelOneCode::checkJumpSlide(Player *mPlayer){
  * Changes player position according to current speed.
  */
 void LevelOneCode::updatePlayerPosition(Player *mPlayer){
-	double deltaWalked =  mPlayer->mSpeed.first;
+	double deltaWalked =  mPlayer->mSpeed.first * engine::Game::instance.getTimer().getDeltaTime();
 	//Updates position in relation to current speed
 	mPlayer->mCurrentPosition.first += deltaWalked;
 }
@@ -343,11 +398,12 @@ void LevelOneCode::updatePlayerPosition(Player *mPlayer){
  * 
  */
 void LevelOneCode::updatePhysics() {	
+	//Every contact was found by the physics world, before the player moves
 	//Check if player is on air or sliding
 	checkJumpSlide(mPlayer);
 	updatePlayerPosition(mPlayer);
 	//Limiting player position on canvas.
-	maxPosition(mPlayer, gameObject);
+	maxPosition(mPlayer);
 	//Updating player state in relation to obstacles
 	checkCollisions(mPlayer);
 }
@@ -399,231 +455,3 @@ void LevelOneCode::handleCollisionCeiling(Obstacle *obstacle, Player *mPlayer, d
 	*groundY = blockBottom;
 }
 
-
-/*
- * @brief Makes it so collisions with MachineParts collects them.
- * 
- * 
- */
-bool LevelOneCode::collectMachinePart(double playerTop, double playerBottom, double playerRight, double playerLeft,
-									  Obstacle *obstacle, Player *mPlayer, std::list<Obstacle *> mObstacleList){
-
-    std::pair<double, double> blockBottomLeft = obstacle->calcBottomLeft();
-	std::pair<double, double> blockTopRight = obstacle->calcTopRight();
-
-	const int DISTANCE_LEFT = 5;
-	const int DISTANCE_TOP = 16; 
-	const int DISTANCE_RIGHT = 5;
-	const int DISTANCE_BOTTOM = 16;
-	// These magic numbers are used because the walls must be a bit at the front of the top
-	double blockRight = blockTopRight.first + DISTANCE_RIGHT;
-	double blockLeft = blockBottomLeft.first - DISTANCE_LEFT;
-	double blockTop = blockTopRight.second + DISTANCE_TOP;
-	double blockBottom = blockBottomLeft.second - DISTANCE_BOTTOM;
-
-	if (playerLeft < blockLeft && playerLeft < blockRight &&
-		playerTop <= blockBottom && playerBottom >= blockTop &&
-		playerRight >= blockLeft) {
-
-		obstacle->mMachinePartState = MachinePartState::COLLECTED;
-		mPlayer->mCollectedParts++;
-		mObstacleList.remove(obstacle);
-
-		return true;
-	} else {
-		//Nothing to do.
-		return false;
-	}
-}
-
-
-/*
- * @brief Checks if player is touching the ground.
- * 
- * 
- */
-bool LevelOneCode::hasGround(double *groundY) {
-	ASSERT(*groundY == 0.0,"groundY must be initialized at 0.0");
-	std::pair<double, double> playerBottomLeft = mPlayer->calcBottomLeft();
-	std::pair<double, double> playerTopRight = mPlayer->calcTopRight();
-
-	double playerTop = playerTopRight.second;
-	double playerBottom = playerBottomLeft.second;
-	double playerLeft = playerBottomLeft.first;
-	double playerRight = playerTopRight.first;
-
-	for (auto eachObstacle : mObstacleList) {
-		// If the obstacle is a machine part, we check the collision without invisible blocks (since it has animation).
-		// If it collides, we return false (so the position isn't updated) and change the state of the machine part.
-		// TODO(Roger): update the collision methods so they return the colliding object.
-		// TODO(Roger): Create states to the machine parts.
-
-		if (eachObstacle->mObstacleType == ObstacleType::MACHINE_PART) {
-			std::pair<double, double> blockBottomLeft = eachObstacle->calcBottomLeft();
-			std::pair<double, double> blockTopRight = eachObstacle->calcTopRight();
-
-			double blockRight = blockTopRight.first;
-			double blockLeft = blockBottomLeft.first;
-			double blockTop = blockTopRight.second;
-
-			if (playerLeft <= blockRight && playerRight >= blockLeft &&
-				playerBottom > blockTop && playerTop < blockTop) {
-				// Collided.
-				eachObstacle->mMachinePartState = MachinePartState::COLLECTED;
-				mPlayer->mCollectedParts++;
-				mObstacleList.remove(eachObstacle);
-				return false;
-			} else {
-				//Nothing to do.
-			}
-		} else {
-			for (auto eachBlock : eachObstacle->mBlockList) {
-				std::pair<double, double> blockBottomLeft = eachBlock->calcBottomLeft();
-				std::pair<double, double> blockTopRight = eachBlock->calcTopRight();
-
-				double blockRight = blockTopRight.first;
-				double blockLeft = blockBottomLeft.first;
-				double blockTop = blockTopRight.second;
-
-				if (playerLeft <= blockRight && playerRight >= blockLeft &&
-					playerBottom > blockTop && playerTop < blockTop) {
-						*groundY = blockTop;
-					handleCollisionGround(eachObstacle, mPlayer);
-					return true;
-				} else {
-					//Nothing to do.
-				}
-			}
-		}
-	}
-
-	return false;
-}
-
-
-/*
- * @brief Checks if there is an obstacle on the right of player.
- * 
- * 
- */
-bool LevelOneCode::hasWallOnRight(double *wallX) {
-	ASSERT(*wallX == 0.0,"wallX must be initialized at 0.0");
-	std::pair<double, double> playerBottomLeft = mPlayer->calcBottomLeft();
-	std::pair<double, double> playerTopRight = mPlayer->calcTopRight();
-
-	double playerTop = playerTopRight.second;
-	double playerBottom = playerBottomLeft.second;
-	double playerLeft = playerBottomLeft.first;
-	double playerRight = playerTopRight.first;
-
-	for (auto eachObstacle : mObstacleList) {
-		const int DISTANCE_RIGHT = 5;
-		const int DISTANCE_LEFT = 5;
-		const int DISTANCE_TOP = 16;
-		const int DISTANCE_BOTTOM = 16;
-
-		if (eachObstacle->mObstacleType == ObstacleType::MACHINE_PART) {
-				if(collectMachinePart(playerTop, playerBottom, playerRight, playerLeft,
-									  eachObstacle, mPlayer, mObstacleList)){
-					// Abort if MachinePart collected, nothing to collide with
-				    return false;
-				}
-			} else {
-				for (auto eachBlock : eachObstacle->mBlockList) {
-					std::pair<double, double> blockBottomLeft = eachBlock->calcBottomLeft();
-					std::pair<double, double> blockTopRight = eachBlock->calcTopRight();
-
-					// These magic numbers are used because the walls must be a bit at the front of the top.
-					double blockRight = blockTopRight.first + DISTANCE_RIGHT;
-					double blockLeft = blockBottomLeft.first - DISTANCE_LEFT;
-					double blockTop = blockTopRight.second + DISTANCE_TOP;
-					double blockBottom = blockBottomLeft.second - DISTANCE_BOTTOM;
-
-					if (playerLeft < blockLeft && playerLeft < blockRight &&
-						playerTop <= blockBottom && playerBottom >= blockTop &&
-						playerRight >= blockLeft) {
-							
-							handleCollisionSide(eachObstacle, mPlayer, wallX, -1.0, blockLeft);
-							return true;
-					}
-						else {
-							//Nothing to do.
-						}
-			}
-		}
-	}
-	return false;
-}
-
-
-/*
- * @brief Checks if there is an obstacle on left of player.
- * 
- * 
- */
-bool LevelOneCode::hasWallOnLeft(double *wallX) {
-	ASSERT(*wallX == 0.0,"wallX must be initialized at 0.0");
-	std::pair<double, double> playerBottomLeft = mPlayer->calcBottomLeft();
-	std::pair<double, double> playerTopRight = mPlayer->calcTopRight();
-
-	double playerTop = playerTopRight.second;
-	double playerBottom = playerBottomLeft.second;
-	double playerLeft = playerBottomLeft.first;
-	double playerRight = playerTopRight.first;
-	for (auto eachObstacle : mObstacleList) {
-		for (auto eachBlock : eachObstacle->mBlockList) {
-			std::pair<double, double> blockBottomLeft = eachBlock->calcBottomLeft();
-			std::pair<double, double> blockTopRight = eachBlock->calcTopRight();
-
-			double blockRight = blockTopRight.first;
-			double blockTop = blockTopRight.second;
-			double blockBottom = blockBottomLeft.second;
-
-			if (playerLeft <= blockRight && playerRight > blockRight &&
-				playerTop <= blockBottom && playerBottom >= blockTop) {
-				handleCollisionSide(eachObstacle, mPlayer, wallX, +1.0, blockRight);
-				return true;
-			}
-		}
-	}
-	return false;
-}
-
-
-/*
- * @brief Checks if there is a ceiling on top of player.
- * 
- * 
- */
-bool LevelOneCode::hasCeiling(double *groundY) {
-	ASSERT(*groundY == 0.0,"groundY must be initialized at 0.0");
-	std::pair<double, double> playerBottomLeft = mPlayer->calcBottomLeft();
-	std::pair<double, double> playerTopRight = mPlayer->calcTopRight();
-
-	double playerTop = playerTopRight.second;
-	double playerBottom = playerBottomLeft.second;
-	double playerLeft = playerBottomLeft.first;
-	double playerRight = playerTopRight.first;
-
-	for (auto eachObstacle : mObstacleList) {
-		for (auto eachBlock : eachObstacle->mBlockList) {
-			std::pair<double, double> blockBottomLeft = eachBlock->calcBottomLeft();
-			std::pair<double, double> blockTopRight = eachBlock->calcTopRight();
-
-			double blockLeft = blockBottomLeft.first;
-			double blockRight = blockTopRight.first;
-			double blockTop = blockTopRight.second;
-			double blockBottom = blockBottomLeft.second;
-
-			if (playerLeft >= blockLeft && playerRight <= blockRight &&
-				playerTop <= blockBottom && playerBottom >= blockTop &&
-				playerTop >= blockTop) {
-					handleCollisionCeiling(eachObstacle, mPlayer, groundY, blockBottom);
-					return true;
-				} else {
-					//Nothing to do
-				}
-			}
-		}
-		return false;
-}
\ No newline at end of file
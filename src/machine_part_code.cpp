@@ -10,6 +10,7 @@
 
 #include "machine_part_code.hpp"
 #include "obstacle.hpp"
+#include "player.hpp"
 
 using namespace Azo;
 
@@ -32,7 +33,8 @@ MachinePartCode::~MachinePartCode() {}
 MachinePartCode::MachinePartCode(Obstacle *machinePart) {
         DEBUG("Creating machinePartCode.");
 	mMachinePart = machinePart; // Variable responsible for the creation of the pieces of the game
-	findAudioController();
+	mAudioController = mMachinePart->getComponent<engine::AudioController>();
+	ASSERT(mAudioController != NULL, "The machine part must have an AudioController.");
 }
 
 /**
@@ -52,39 +54,27 @@ void MachinePartCode::shutdown(){
         }
 }
 
-/** 
-     * @brief function responsible for updating part State on the map
-     *
-     * Why: For the status of the parts to be updated
-     *
-     * @return "void".
-     */
-void MachinePartCode::updateCode() {
-	switch(mMachinePart->mMachinePartState) {
-		case MachinePartState::COLLECTED:
-                        DEBUG("Collected a machinePart.");
-			mAudioController->playAudio("coleta");
-
-		        mMachinePart->mMachinePartState = MachinePartState::FINISHED;
-			break;
-		case MachinePartState::FINISHED:
-                        DEBUG("Disabled a machinePart.");
-			mMachinePart->mObjectState = engine::ObjectState::DISABLED;
-                        break;
-		default:
-                        // Nothing to do, MachinePart not collected.
-                        break;
-	}
-}
-
 /**
-     * @brief function responsible for finding the audio driver
+     * @brief function responsible for collecting the part when the player touches it
+     *
+     * Why: The physics world only tells the part once, when the player enters it
      *
-     * Why: To allow access to the audio driver
+     * @param event whether the player started or stopped touching the part
+     * @param other collider of the player
      *
      * @return "void".
      */
-void MachinePartCode::findAudioController() {
-        DEBUG("Calling MachinePartCode::findAudioController.");
-	mAudioController = (mMachinePart->getAudioController(typeid(engine::AudioController)));
+void MachinePartCode::onCollision(engine::CollisionEvent event, engine::ColliderComponent &other) {
+	if (event == engine::CollisionEvent::ENTER &&
+	    mMachinePart->mMachinePartState == MachinePartState::NON_COLLECTED) {
+                DEBUG("Collected a machinePart.");
+		mMachinePart->mMachinePartState = MachinePartState::COLLECTED;
+		// The trigger mask only has the player layer.
+		static_cast<Player &>(other.getGameObject()).mCollectedParts++;
+		mAudioController->playAudio("coleta");
+		mMachinePart->mObjectState = engine::ObjectState::DISABLED;
+	}
+	else {
+                // Nothing to do, part already collected or left behind.
+	}
 }
@@ -9,11 +9,68 @@
      */
 #include "game.hpp"
 #include "game_globals.hpp"
+#include "profiler.hpp"
 #include "level_one.hpp"
 #include "menu.hpp"
 
+#include <cstdlib>
+#include <cstring>
+
 using namespace Azo;
 
+/**
+     * @brief read the command line options.
+     *
+     * --headless runs without window or audio device, --headless-draw also keeps
+     * drawing into an offscreen canvas, --frames N exits after N frames and
+     * --profile FILE writes a chrome://tracing file when the game exits.
+     * --render-thread simulates on a thread apart from drawing and --stats FILE
+     * writes the frame time percentiles of each scene (CSV, or JSON when FILE
+     * ends in .json) when the game exits. --endless SEED starts on the endless
+     * level built from SEED instead of the menu.
+	 *
+	 * @param firstScene gets the scene the game starts on.
+	 * @param endlessSeed gets the seed of the endless level.
+	 *
+	 * @return "void".
+     */
+void parseArguments(int argc, char **argv, std::string &firstScene, uint32_t &endlessSeed) {
+	bool headless = false;
+	bool drawOffscreen = false;
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--headless") == 0) {
+			headless = true;
+		} else if (strcmp(argv[i], "--headless-draw") == 0) {
+			headless = true;
+			drawOffscreen = true;
+		} else if (strcmp(argv[i], "--stats") == 0 && i + 1 < argc) {
+			i++;
+			engine::Game::instance.getFrameStatistics().setOutputPath(argv[i]);
+		} else if (strcmp(argv[i], "--render-thread") == 0) {
+			engine::Game::instance.setRenderThread(true);
+		} else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+			i++;
+#ifndef NPROFILE
+			engine::Profiler::instance.setOutputPath(argv[i]);
+#else
+			WARN("Built with NPROFILE, no trace is written to " << argv[i]);
+#endif
+		} else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+			i++;
+			engine::Game::instance.setFrameLimit(strtoul(argv[i], NULL, 10));
+		} else if (strcmp(argv[i], "--endless") == 0 && i + 1 < argc) {
+			i++;
+			firstScene = "endless";
+			endlessSeed = strtoul(argv[i], NULL, 10);
+		} else {
+			WARN("Unknown argument: " << argv[i]);
+		}
+	}
+
+	engine::Game::instance.setHeadless(headless, drawOffscreen);
+}
+
 /**
      * @brief function responsible for calling and compiling the game
      *
@@ -21,24 +78,30 @@ using namespace Azo;
 	 *
 	 * @return Integer with output status.
      */
-int main(int, char**) {
+int main(int argc, char **argv) {
 	// Setting the game global variables (such as screen size and frame rate) before starting.
 	engine::Game::instance.setAttributes(
 		global::GAME_NAME,
 		global::WINDOWN_WIDTH,
 		global::WINDOWN_HEIGHT,
 		global::FRAME_RATE);
+	engine::Game::instance.setSimulationRate(global::SIMULATION_RATE);
+	std::string firstScene = "menu";
+	uint32_t endlessSeed = 0;
+	parseArguments(argc, argv, firstScene, endlessSeed);
 
 	// Creating references to the scenes of the game.
 	LevelOne level_one("level_one");
+	LevelOne endless("endless", endlessSeed);
 	Menu menu("menu");
 
 	// Adding scenes to the map
 	engine::Game::instance.addScene(level_one);
+	engine::Game::instance.addScene(endless);
 	engine::Game::instance.addScene(menu);
 
-	// Changing scene to ' menu '
-	engine::Game::instance.changeScene("menu");
+	// Changing scene to ' menu ', or the endless level
+	engine::Game::instance.changeScene(firstScene);
 
 	// Running game 
 	engine::Game::instance.run();
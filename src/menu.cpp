@@ -23,6 +23,19 @@ Menu::Menu(std::string name) {
 	createGameObjects();
 }
 
+/**
+     * @brief function responsible for initializing the menu.
+     *
+     * Why: Because the level assets can load while the player is on the menu
+	 *
+	 * @return "void".
+     */
+void Menu::init(){
+	DEBUG("Calling Menu::init.");
+	engine::Scene::init();
+	engine::Game::instance.prepareScene("level_one");
+}
+
 /**
      * @brief function responsible for restarting the game
      *
@@ -33,6 +46,7 @@ Menu::Menu(std::string name) {
 void Menu::restart(){
 	DEBUG("Calling Menu::restart.");
 	gameObjectMap.clear();
+	deleteKeyList();
 	createGameObjects();
 }
 
@@ -61,8 +75,15 @@ void Menu::shutdown() {
      */
 void Menu::createGameObjects() {
 	DEBUG("Creating Menu GameObjects.");
-
-	mMenu = new engine::GameObject("menu", std::make_pair(0.0, 0.0));
+	// The objects of the last run aren't shut down with the menu, they go all at once here.
+	mArena.reset();
+	mStartButtonSprites.clear();
+	mExitButtonSprites.clear();
+	mSoundEnabledButtonSprites.clear();
+	mSoundDisabledButtonSprites.clear();
+	mArrowSprites.clear();
+
+	mMenu = mArena.create<engine::GameObject>("menu", std::make_pair(0.0, 0.0));
 	ASSERT(mMenu != NULL, "The mMenu can't be null."); 
 
 	createMenuComponents();
@@ -80,11 +101,11 @@ void Menu::createMenuComponents() {
 	DEBUG("Creating Menu Components.");
 
 	DEBUG("Adding Menu audio component.");
-	mMenuTheme = new engine::AudioComponent(*mMenu, "audios/TemaGame.ogg", true, true);
+	mMenuTheme = mArena.create<engine::AudioComponent>(*mMenu, "audios/TemaGame.ogg", true, true);
     ASSERT(mMenuTheme != NULL, "The mMenuTheme can't be null.");
 
 	DEBUG("Adding Menu audio controller.");
-	mAudioController = new engine::AudioController();
+	mAudioController = mArena.create<engine::AudioController>();
     ASSERT(mAudioController != NULL, "The mAudioController can't be null.");
 
 	DEBUG("Adding Menu audio theme.");
@@ -92,13 +113,13 @@ void Menu::createMenuComponents() {
 	mMenu->addComponent(*mAudioController);
 
 	DEBUG("Adding Menu animation controller.");
-	mAnimationController = new engine::AnimationController(*mMenu);
+	mAnimationController = mArena.create<engine::AnimationController>(*mMenu);
 	ASSERT(mAnimationController != NULL, "The mAnimationController can't be null.");
 
 	generateButtonsAnimation();
 
 	DEBUG("Generating Menu start button.");
-	mStartButton = new engine::Animation(*mMenu,
+	mStartButton = mArena.create<engine::Animation>(*mMenu,
 					       				 "general_images/textos.png",
 					       				 1.0f, // animationTime
 					       				 mStartButtonSprites,
@@ -113,7 +134,7 @@ void Menu::createMenuComponents() {
 	mAnimationController->addAnimation("start_button", *mStartButton);
 
 	DEBUG("Generating Menu arrow start.");
-	mArrowStart = new engine::Animation(*mMenu,
+	mArrowStart = mArena.create<engine::Animation>(*mMenu,
 					      				"general_images/textos.png",
 					      				1.0f,
 					      				mArrowSprites,
@@ -127,7 +148,7 @@ void Menu::createMenuComponents() {
 	mAnimationController->addAnimation("arrow_start", *mArrowStart);
 
 	DEBUG("Generating Menu exit button.");
-	mExitButton = new engine::Animation(*mMenu,
+	mExitButton = mArena.create<engine::Animation>(*mMenu,
 					      				"general_images/textos.png",
 					      				1.0f,
 					      				mExitButtonSprites,
@@ -141,7 +162,7 @@ void Menu::createMenuComponents() {
 	mAnimationController->addAnimation("exit_button", *mExitButton);
 
 	DEBUG("Generating Menu arrow exit.");
-	mArrowExit = new engine::Animation(*mMenu,
+	mArrowExit = mArena.create<engine::Animation>(*mMenu,
 					     				"general_images/textos.png",
 					     				1.0f,
 					     				mArrowSprites,
@@ -157,7 +178,7 @@ void Menu::createMenuComponents() {
 	mAnimationController->addAnimation("arrow_exit", *mArrowExit);
 
 	DEBUG("Generating Menu sound enabled button.");
-	mSoundEnabledButton = new engine::Animation(*mMenu,
+	mSoundEnabledButton = mArena.create<engine::Animation>(*mMenu,
 						      				   "general_images/textos.png",
 						      				   1.0f,
 						      				   mSoundEnabledButtonSprites,
@@ -172,7 +193,7 @@ void Menu::createMenuComponents() {
 	mAnimationController->addAnimation("sound_enabled_button", *mSoundEnabledButton);
 
 	DEBUG("Generating Menu sound disabled button.");
-	mSoundDisabledButton = new engine::Animation(*mMenu,
+	mSoundDisabledButton = mArena.create<engine::Animation>(*mMenu,
 												 "general_images/textos.png",
 												 1.0f,
 												 mSoundDisabledButtonSprites,
@@ -190,7 +211,7 @@ void Menu::createMenuComponents() {
 	mAnimationController->addAnimation("sound_disabled_button", *mSoundDisabledButton);
 
 	DEBUG("Generating Menu arrow sound.");
-	mArrowSound = new engine::Animation(*mMenu,
+	mArrowSound = mArena.create<engine::Animation>(*mMenu,
 					      				"general_images/textos.png",
 					      				1.0f,
 					      				mArrowSprites,
@@ -209,13 +230,13 @@ void Menu::createMenuComponents() {
 	mMenu->addComponent(* mAnimationController);
 
 	DEBUG("Creating Menu background.");
-	mBackground = new engine::BackgroundComponent(*mMenu, "backgrounds/menu.png");
+	mBackground = mArena.create<engine::BackgroundComponent>(*mMenu, "backgrounds/menu.png");
 	ASSERT(mBackground!= NULL, "The mBackground can't be null.");
 
 	mMenu->addComponent(*mBackground);
 
 	DEBUG("Creating the Menu code component.");
-	mCode = new MenuCode(mMenu);
+	mCode = mArena.create<MenuCode>(mMenu);
 	ASSERT(mCode != NULL, "The mCode can't be null."); 
 
 	mMenu->addComponent(*mCode);
@@ -230,7 +251,7 @@ void Menu::createMenuComponents() {
      */
 void Menu::generateButtonsAnimation() {
 	DEBUG("Generating Menu start button sprites.");
-	mStartButtonSprites.push_back(new engine::Sprite());
+	mStartButtonSprites.push_back(mArena.create<engine::Sprite>());
 
 	/*
 		Set the animation sprites coordinates (x, y)
@@ -245,7 +266,7 @@ void Menu::generateButtonsAnimation() {
 	mStartButtonSprites[0]->setSpriteHeight((unsigned int)(478 - 452));
 
 	DEBUG("Generating Menu exit button sprites.");
-	mExitButtonSprites.push_back(new engine::Sprite());
+	mExitButtonSprites.push_back(mArena.create<engine::Sprite>());
 
 	DEBUG("Setting Menu exit button sprites position.");
 	mExitButtonSprites[0]->setSpriteX((unsigned int)207);
@@ -254,7 +275,7 @@ void Menu::generateButtonsAnimation() {
 	mExitButtonSprites[0]->setSpriteHeight((unsigned int)(441 - 413));
 
 	DEBUG("Generating Menu sound enabled button sprites.");
-	mSoundEnabledButtonSprites.push_back(new engine::Sprite());
+	mSoundEnabledButtonSprites.push_back(mArena.create<engine::Sprite>());
 
 	DEBUG("Setting Menu sound enabled button sprites position.");
 	mSoundEnabledButtonSprites[0]->setSpriteX((unsigned int)660);
@@ -263,7 +284,7 @@ void Menu::generateButtonsAnimation() {
 	mSoundEnabledButtonSprites[0]->setSpriteHeight((unsigned int)(77 - 46));
 
 	DEBUG("Generating Menu sound disabled button sprites.");
-	mSoundDisabledButtonSprites.push_back(new engine::Sprite());
+	mSoundDisabledButtonSprites.push_back(mArena.create<engine::Sprite>());
 
 	DEBUG("Generating Menu sound disabled button sprites position.");
 	mSoundDisabledButtonSprites[0]->setSpriteX((unsigned int)608);
@@ -272,7 +293,7 @@ void Menu::generateButtonsAnimation() {
 	mSoundDisabledButtonSprites[0]->setSpriteHeight((unsigned int)(77 - 46));
 
 	DEBUG("Generating Menu arrow sprites.");
-	mArrowSprites.push_back(new engine::Sprite());
+	mArrowSprites.push_back(mArena.create<engine::Sprite>());
 
 	DEBUG("Generating Menu arrow sprites position.");
 	mArrowSprites[0]->setSpriteX((unsigned int)582);
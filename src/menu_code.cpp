@@ -28,45 +28,15 @@ MenuCode::MenuCode(engine::GameObject *gameObject){
 	ASSERT(&gameObject != NULL, "GameObject can't be null.");
 	this->gameObject = gameObject; // Variable responsible for game object.
 	ASSERT(this->gameObject == gameObject, "gameObject must have correct value.");
-	findAudioController();
-	findAnimationController();
-}
-/**
-     * @brief function responsible for finding animation controller
-     *
-     * Why: Used to control the animation of the game
-     *
-     * @return "void".
-     */
-void MenuCode::findAnimationController(){
-	DEBUG("Finding animation controller on menu code.");
-	mAnimationController = (gameObject->getAnimationController(typeid(engine::AnimationController)));
-	if(mAnimationController == NULL) {
-		errorCode = FunctionStatus::NULLPOINTER;
-		errorLog("MenuCode::findAnimationController");
-	} else {
-		errorCode = FunctionStatus::SUCCESS;
-	}
-}
-
-/**
-     * @brief function responsible for finding audio controller
-     *
-     * Why: Used to control game audio
-     *
-     * @return "void".
-     */
-void MenuCode::findAudioController(){
-	DEBUG("Finding audio controller on menu code.");
-	mAudioController = (gameObject->getAudioController(typeid(engine::AudioController)));
-	if(mAudioController == NULL) {
+	mAudioController = gameObject->getComponent<engine::AudioController>();
+	mAnimationController = gameObject->getComponent<engine::AnimationController>();
+	if(mAudioController == NULL || mAnimationController == NULL) {
 		errorCode = FunctionStatus::NULLPOINTER;
-		errorLog("MenuCode::findAudioController");
+		errorLog("MenuCode::MenuCode");
 	} else {
 		errorCode = FunctionStatus::SUCCESS;
 	}
 }
-
 /**
      * @brief function responsible for selecting game option
      *
@@ -35,20 +35,62 @@ Obstacle::~Obstacle(){}
 * @param name Obstacle name.
 * @param positionRelativeToParent Pair of doubles relative to position(range > 0).
 * @param obstacleType Type of obstacle according to enum class ObstacleType from obstacle.hpp.
+* @param arena Arena the Obstacle is built on, its components and sprites are built there too.
 */
-Obstacle::Obstacle(std::string name, std::pair<double, double> positionRelativeToParent, ObstacleType obstacleType) {
+Obstacle::Obstacle(
+	std::string name,
+	std::pair<double, double> positionRelativeToParent,
+	ObstacleType obstacleType,
+	engine::Arena &arena
+) {
 	DEBUG("Initializing Obstacle variables");
 	// Initializing Obstacle variables.
+	setArena(arena);
 	mName = name;
 	ASSERT(mName != "", "name can't be empty.");
-	mPositionRelativeToParent = positionRelativeToParent;
-	mCurrentPosition = mPositionRelativeToParent;
+	setLocalPosition(positionRelativeToParent);
 	mObstacleType = obstacleType;
 
 	DEBUG("Calling createComponents");
 	createComponents();
 }
 
+/**
+* @brief Constructor class for Obstacle with the blocks of a level.
+*
+* Used to build the obstacles of a level file, whose blocks replace the
+* ones of the type.
+* @param name Obstacle name.
+* @param positionRelativeToParent Pair of doubles relative to position(range > 0).
+* @param obstacleType Type of obstacle according to enum class ObstacleType from obstacle.hpp.
+* @param blockList First block of the obstacle on the level.
+* @param blockCount Number of blocks of the obstacle.
+* @param arena Arena the Obstacle is built on, its components and sprites are built there too.
+*/
+Obstacle::Obstacle(
+	std::string name,
+	std::pair<double, double> positionRelativeToParent,
+	ObstacleType obstacleType,
+	const LevelBlock *blockList,
+	unsigned int blockCount,
+	engine::Arena &arena
+) {
+	setArena(arena);
+	mName = name;
+	ASSERT(mName != "", "name can't be empty.");
+	ASSERT(blockList != NULL, "blockList can't be NULL.");
+	setLocalPosition(positionRelativeToParent);
+	mObstacleType = obstacleType;
+	mLevelBlockList = blockList;
+	mLevelBlockCount = blockCount;
+
+	createComponents();
+
+	// The blocks belong to the level file, which may close.
+	mLevelBlockList = NULL;
+	mLevelBlockCount = 0;
+}
+
 /**
 * @brief Destructor class for Obstacle.
 *
@@ -58,50 +100,61 @@ Obstacle::Obstacle(std::string name, std::pair<double, double> positionRelativeT
 void Obstacle::shutdown() {
 	DEBUG("Calling Obstacle shutdown");
 
-	clearEachBlock();
+	clearColliders();
+	resetSpinningValue();
 	clearAnimations();
 	clearImages();
 	clearAudio();
 	resetCollectedValue();
-	resetSpinningValue();
 	shutdownMachinePartCode();
 }
 
 /**
-* @brief Method to clear eachBlock from mBlockList.
+* @brief Method to write the Obstacle state.
+*
+* Besides the game object state, writes whether the part was collected.
+*/
+void Obstacle::saveState(engine::StateBuffer &stateBuffer) {
+	engine::GameObject::saveState(stateBuffer);
+	stateBuffer.write(mMachinePartState);
+}
+
+/**
+* @brief Method to read back the Obstacle state.
 *
-* Used to clear eachBlock from mBlockList.
+* Reads in the same order as saveState.
+*/
+void Obstacle::loadState(engine::StateBuffer &stateBuffer) {
+	engine::GameObject::loadState(stateBuffer);
+	stateBuffer.read(mMachinePartState);
+}
+
+/**
+* @brief Method to clear each collider from mColliderList.
+*
+* Used to take the colliders out of the physics world, they're freed with
+* the other components of the Obstacle.
 * All of them must be shutted down before Obstacle can also be shutted down.
 */
-void Obstacle::clearEachBlock() {
-	for (auto eachBlock : mBlockList) {
-		DEBUG("Deleting eachBlock from mBlockList");
-		if (eachBlock != NULL) {
-			eachBlock->shutdown();
-			delete(eachBlock);
-			eachBlock = NULL;
-		} else {
-			//Nothing to do, the pointer is already null
-		}
+void Obstacle::clearColliders() {
+	for (auto eachCollider : mColliderList) {
+		DEBUG("Shutting down eachCollider from mColliderList");
+		eachCollider->shutdown();
 	}
+
+	mColliderList.clear();
 }
 
 /**
 * @brief Method to clear animations.
 *
-* Used to clear any animations remaining before shutting down Obstacle.
+* Used to clear any animations remaining before shutting down Obstacle. The
+* sprites are freed with the Obstacle.
 */
 void Obstacle::clearAnimations() {
 	if (mSpinningAnimationSprites.size() > 0) {
 		DEBUG("Clearing mSpinningAnimationSprites that remained");
-		for (auto eachAnimation : mSpinningAnimationSprites) {
-			if (eachAnimation != NULL) {
-				delete(eachAnimation);
-				eachAnimation = NULL;
-			} else {
-				//Nothing to do, the pointer is already null
-			}
-		}
+		mSpinningAnimationSprites.clear();
 	} else {
 		//Nothing to do, there is no mSpinningAnimationSprites
 	}
@@ -115,7 +168,7 @@ void Obstacle::clearAnimations() {
 void Obstacle::clearImages() {
 	if (mObstacleImage != NULL) {
 		DEBUG("Clearing mObstacleImage");
-		delete(mObstacleImage);
+		mObstacleImage->shutdown();
 		mObstacleImage = NULL;
 	} else {
 		//Nothing to do, the pointer is already null
@@ -131,7 +184,6 @@ void Obstacle::clearAudio() {
 	if (mAudioController != NULL) {
 		DEBUG("Clearing mAudioController");
 		mAudioController->shutdown();
-		delete(mAudioController);
 		mAudioController = NULL;
 	} else {
 		//Nothing to do, the pointer is already null
@@ -160,7 +212,9 @@ void Obstacle::resetCollectedValue() {
 void Obstacle::resetSpinningValue() {
 	if (mSpinning != NULL) {
 		DEBUG("Reseting mSpinning");
-		delete(mSpinning);
+		// Its shutdown takes it out of the animations drawn.
+		mSpinning->shutdown();
+		mSpinningAnimationSprites.clear();
 		mSpinning = NULL;
 	} else {
 		//Nothing to do, the pointer is already null
@@ -176,7 +230,6 @@ void Obstacle::shutdownMachinePartCode() {
 	if (mMachinePartCode != NULL) {
 		DEBUG("Shutting down mMachinePartCode");
 		mMachinePartCode->shutdown();
-		delete(mMachinePartCode);
 		mMachinePartCode = NULL;
 	} else {
 		//Nothing to do, the pointer is already null
@@ -245,9 +298,7 @@ void Obstacle::initImageObstacle(
 	std::string obstaclePath
 ) {
 	DEBUG("Obstacle is a " << obstacleName);
-	mObstacleImage = new engine::ImageComponent(*this, obstaclePath, 1.0);
-	ASSERT(mObstacleImage != NULL, "engine::ImageComponent, mObstacleImage can't be NULL.");
-	this->addComponent(*mObstacleImage);
+	mObstacleImage = this->addComponent<engine::ImageComponent>(*this, obstaclePath, 1.0);
 	createBlocks();
 	errorCode = FunctionStatusObstacle::SUCCESS;
 }
@@ -261,114 +312,122 @@ void Obstacle::initMachinePart() {
 	DEBUG("Obstacle is a MACHINE PART");
 	mMachinePartState = MachinePartState::NON_COLLECTED;
 	generateSpinAnimation();
-	mSpinning = new engine::Animation(
+	mSpinning = this->addComponent<engine::Animation>(
 		*this, "sprites/machine_part.png",
 		1200.0f, mSpinningAnimationSprites,
 		0.0, 23.0, true, 1.0
 	);
-	this->addComponent(*mSpinning);
 
-	mAudioController = new engine::AudioController();
-	ASSERT(mAudioController != NULL, "engine::AudioController, AudioController can't be NULL.");
-	mCollected = new engine::AudioComponent(*this, "audios/coleta.ogg", false, false);
+	mAudioController = this->addComponent<engine::AudioController>();
+	mCollected = this->create<engine::AudioComponent>(*this, "audios/coleta.ogg", false, false);
 	ASSERT(mCollected != NULL, "engine::AudioComponent, AudioComponent can't be NULL.");
 	mAudioController->addAudio("coleta", *mCollected);
-	this->addComponent(*mAudioController);
 
-	mMachinePartCode = new MachinePartCode(this);
-	ASSERT(mMachinePartCode != NULL, "MachinePartCode, mMachinePartCode can't return NULL.");
-	this->addComponent(*mMachinePartCode);
+	mMachinePartCode = this->addComponent<MachinePartCode>(this);
+
+	// Machine parts are collected by touching their animation, which gives them their size.
+	// Only the player sees them, and they're only told when it enters.
+	engine::ColliderComponent *trigger = this->addComponent<engine::ColliderComponent>(*this, engine::ColliderType::STATIC);
+	trigger->setTrigger(true);
+	trigger->setLayer(global::COLLECTIBLE_LAYER);
+	trigger->setMask(global::PLAYER_LAYER);
+	mColliderList.push_back(trigger);
 	errorCode = FunctionStatusObstacle::SUCCESS;
 }
 
 /**
 * @brief Method for creating blocks.
 *
-* Used to create invisible objects that compose the Obstacle based on the type
-* of the object.
-* Note that the name of the InvisibleBlock is only for internal use.
+* Used to create the solid colliders that compose the Obstacle, from the level
+* when it gives them, otherwise based on the type of the object.
 */
 void Obstacle::createBlocks() {
 	/*
-	We initialize the block' position as the position relative to parent of the obstacle.
-	This way we can position things inside the obstacle just by adding values to the position.
+	Blocks are placed relative to the obstacle position, so they follow it.
+	This way we can position things inside the obstacle just by adding values to the offset.
 	*/
-	std::pair<double, double> blockPosition = mPositionRelativeToParent;
-
-	// If and else if blocks for setting obstacle position based on its type ObstacleType.
-	switch (mObstacleType) {
-		DEBUG("Setting obstacle position");
-
-		case ObstacleType::GROUND:
-		setObstaclePosition("block_1", blockPosition, 21000.0, 100.0);
-		break;
-
-		case ObstacleType::WESTERN_CAR:
-		blockPosition.first += 69.0;
-		blockPosition.second += 20.0;
-		setObstaclePosition("block_2", blockPosition, 109.0, 143.0);
-		break;
-
-		case ObstacleType::WESTERN_BOX:
-		blockPosition.first += 58.0;
-		blockPosition.second += 6.0;
-		setObstaclePosition("block_3", blockPosition, 63.0, 73.0);
-		break;
+	std::pair<double, double> blockOffset = std::make_pair(0.0, 0.0);
 
-		case ObstacleType::WESTERN_RAISED_BOX:
-		blockPosition.first += 35.0;
-		blockPosition.second += 6.0;
-		setObstaclePosition("block_4", blockPosition, 50.0, 68.0);
-		break;
-
-		case ObstacleType::WESTERN_ROCK:
-		blockPosition.first += 80.0;
-		blockPosition.second += 12.0;
-		setObstaclePosition("block_5", blockPosition, 4.0, 100.0);
-		break;
-
-		case ObstacleType::WESTERN_SPIKE:
-		blockPosition.first += 19.0;
-		blockPosition.second += 23.0;
-		setObstaclePosition("block_6", blockPosition, 210.0, 92.0);
-		break;
-
-		case ObstacleType::WESTERN_POST:
-		blockPosition.first += 48.0;
-		blockPosition.second += 32.0;
-		setObstaclePosition("block_7", blockPosition, 23.0, 106.0);
-		break;
-
-		default:
-		//Nothing to do, there is no component with this type
-		errorCode = FunctionStatusObstacle::WRONGTYPE;
-		errorLog("Obstacle::createBlocks");
-		break;
+	if (mLevelBlockList != NULL) {
+		for (unsigned int index = 0; index < mLevelBlockCount; index++) {
+			const LevelBlock &block = mLevelBlockList[index];
+			addBlock(std::make_pair(block.x, block.y), block.width, block.height);
+		}
+	} else {
+		// If and else if blocks for setting block offset based on its type ObstacleType.
+		switch (mObstacleType) {
+			DEBUG("Setting block offset");
+
+			case ObstacleType::GROUND:
+			addBlock(blockOffset, 21000.0, 100.0);
+			break;
+
+			case ObstacleType::WESTERN_CAR:
+			blockOffset.first += 69.0;
+			blockOffset.second += 20.0;
+			addBlock(blockOffset, 109.0, 143.0);
+			break;
+
+			case ObstacleType::WESTERN_BOX:
+			blockOffset.first += 58.0;
+			blockOffset.second += 6.0;
+			addBlock(blockOffset, 63.0, 73.0);
+			break;
+
+			case ObstacleType::WESTERN_RAISED_BOX:
+			blockOffset.first += 35.0;
+			blockOffset.second += 6.0;
+			addBlock(blockOffset, 50.0, 68.0);
+			break;
+
+			case ObstacleType::WESTERN_ROCK:
+			blockOffset.first += 80.0;
+			blockOffset.second += 12.0;
+			addBlock(blockOffset, 4.0, 100.0);
+			break;
+
+			case ObstacleType::WESTERN_SPIKE:
+			blockOffset.first += 19.0;
+			blockOffset.second += 23.0;
+			addBlock(blockOffset, 210.0, 92.0);
+			break;
+
+			case ObstacleType::WESTERN_POST:
+			blockOffset.first += 48.0;
+			blockOffset.second += 32.0;
+			addBlock(blockOffset, 23.0, 106.0);
+			break;
+
+			default:
+			//Nothing to do, there is no component with this type
+			errorCode = FunctionStatusObstacle::WRONGTYPE;
+			errorLog("Obstacle::createBlocks");
+			break;
+		}
 	}
 }
 
 /**
-* @brief Method for setting obstacle position.
+* @brief Method for adding a block.
 *
-* Used for setting obstacle position.
-* @param blockName Name of block that will be set.
-* @param blockPosition Pair of doubles relative to block position.
-* @param pairFirst Number that indicates first number of pair set.
-* @param pairSecond Number that indicates second number of pair set.
+* Used for adding a static solid collider to the Obstacle.
+* @param blockOffset Pair of doubles from the obstacle position to the block.
+* @param blockWidth Number that indicates the width of the block.
+* @param blockHeight Number that indicates the height of the block.
 */
-void Obstacle::setObstaclePosition(
-	std::string blockName,
-	std::pair<double, double> blockPosition,
-	double pairFirst,
-	double pairSecond
+void Obstacle::addBlock(
+	std::pair<double, double> blockOffset,
+	double blockWidth,
+	double blockHeight
 ) {
-	mBlockList.push_back(
-		new InvisibleBlock(
-			blockName,
-			blockPosition,
-			std::make_pair(pairFirst, pairSecond)
-		)
+	engine::ColliderComponent *block = this->addComponent<engine::ColliderComponent>(
+		*this,
+		engine::ColliderType::STATIC,
+		blockOffset,
+		std::make_pair(blockWidth, blockHeight)
 	);
+	block->setLayer(global::SOLID_LAYER);
+	mColliderList.push_back(block);
 	errorCode = FunctionStatusObstacle::SUCCESS;
 }
 
@@ -383,7 +442,7 @@ void Obstacle::generateSpinAnimation() {
 	const int NUMBER_SPRITES_SPIN_ANIMATION = 24; // Default animation speed is 24 frames per second.
 	// Fill sprites animation up to the NUMBER_SPRITES_SPIN_ANIMATION const.
 	for (int i = 0; i < NUMBER_SPRITES_SPIN_ANIMATION; i++) {
-		mSpinningAnimationSprites.push_back(new engine::Sprite());
+		mSpinningAnimationSprites.push_back(this->create<engine::Sprite>());
 	}
 
 	// Set the animation sprite coordinates (x, y), its width and height
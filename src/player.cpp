@@ -15,10 +15,11 @@
 
 using namespace Azo;  //Used to avoid writing all the path from Azo context
 
-//overloaded constructor of Player instantiating it
-Player::Player(std::string name, std::pair<double, double> currentPosition) {
+//overloaded constructor of Player instantiating it, its components and sprites are built on the arena
+Player::Player(std::string name, std::pair<double, double> currentPosition, engine::Arena &arena) {
 	DEBUG("Player::Player method.");
 
+	setArena(arena);
 	mName = name;
 	mCurrentPosition = currentPosition;
 	createComponents();
@@ -33,7 +34,7 @@ void Player::createComponents() {
 	DEBUG("Creating Player Components.");
 
 	generateWalkingAnimation();
-	mWalking = new engine::Animation(
+	mWalking = create<engine::Animation>(
 		*this,
 		"sprites/CowboyRun.png",
 		1000.0f,
@@ -43,12 +44,12 @@ void Player::createComponents() {
 		true,
 		1
 	);
-	mAnimationController = new engine::AnimationController();
+	mAnimationController = create<engine::AnimationController>();
 	DEBUG("Adding walking animation to animation controller.");
 	mAnimationController->addAnimation("walking", *mWalking);
 
 	generateJumpingAnimation();
-	mJumping = new engine::Animation(
+	mJumping = create<engine::Animation>(
 		*this,
 		"sprites/CowboyJump.png",
 		800.0f,
@@ -63,7 +64,7 @@ void Player::createComponents() {
 	mAnimationController->addAnimation("jumping", *mJumping);
 
 	generateSlidingAnimation();
-	mSliding = new engine::Animation(
+	mSliding = create<engine::Animation>(
 		*this,
 		"sprites/CowboyDesce.png",
 		800.0f,
@@ -77,7 +78,7 @@ void Player::createComponents() {
 	mAnimationController->addAnimation("sliding", *mSliding);
 
 	generateDyingAnimation();
-	mDying = new engine::Animation(
+	mDying = create<engine::Animation>(
 		*this,
 		"sprites/CowboyTonto.png",
 		2000.0f,
@@ -91,7 +92,7 @@ void Player::createComponents() {
 	mAnimationController->addAnimation("dying", *mDying);
 
 	generateLosingAnimation();
-	mLosing = new engine::Animation(
+	mLosing = create<engine::Animation>(
 		*this,
 		"sprites/CowBoyDerrota.png",
 		10000.0f,
@@ -105,7 +106,7 @@ void Player::createComponents() {
 	mAnimationController->addAnimation("losing", *mLosing);
 
 	generateVictoryAnimation();
-	mVictory = new engine::Animation(
+	mVictory = create<engine::Animation>(
 		*this,
 		"sprites/victory.png",
 		10.0f,
@@ -122,26 +123,35 @@ void Player::createComponents() {
 	this->addComponent(*mAnimationController);
 
 	//Generates new audios
-	mLost = new engine::AudioComponent(
+	mLost = create<engine::AudioComponent>(
 		*this,
 		"audios/derrota.ogg",
 		false,
 		false
 	);
-	mVictorySong = new engine::AudioComponent(
+	mVictorySong = create<engine::AudioComponent>(
 		*this,
 		"audios/victory.ogg",
 		false,
 		false
 	);
-	mAudioController = new engine::AudioController();
+	mAudioController = create<engine::AudioController>();
 	mAudioController->addAudio("lost", *mLost);
 	mAudioController->addAudio("victory", *mVictorySong);
 	this->addComponent(*mAudioController);
 
 	DEBUG("Creating Player Code.");
-	mPlayerCode = new PlayerCode(this);
+	mPlayerCode = create<PlayerCode>(this);
 	this->addComponent(*mPlayerCode);
+
+	//The collider follows the measures of the current animation, it sees blocks and machine parts
+	const double WALL_DISTANCE_SIDE = 5.0;
+	const double WALL_DISTANCE_TOP = 16.0; //walls must be a bit at the front of the top
+	mCollider = create<engine::ColliderComponent>(*this, engine::ColliderType::DYNAMIC);
+	mCollider->setWallInset(WALL_DISTANCE_SIDE, WALL_DISTANCE_TOP);
+	mCollider->setLayer(global::PLAYER_LAYER);
+	mCollider->setMask(global::SOLID_LAYER | global::COLLECTIBLE_LAYER);
+	this->addComponent(*mCollider);
 }
 
 /**
@@ -149,7 +159,7 @@ void Player::createComponents() {
  * @return 'void'.
 */
 void Player::generateVictoryAnimation() {
-	mVictoryAnimationSprites.push_back(new engine::Sprite());
+	mVictoryAnimationSprites.push_back(create<engine::Sprite>());
 
 	/*
 	Set the animation sprites coordinates (x, y)
@@ -170,7 +180,7 @@ void Player::generateVictoryAnimation() {
 void Player::generateLosingAnimation() {
 	const int LOSING_SPRITES = 7;
 	for (int i = 0; i < LOSING_SPRITES; i++) {
-		mLosingAnimationSprites.push_back(new engine::Sprite());
+		mLosingAnimationSprites.push_back(create<engine::Sprite>());
 	}
 
 	/*
@@ -224,7 +234,7 @@ void Player::generateWalkingAnimation() {
 	const int WALKING_SPRITES = 23;
 	//A loop to run all the 23 spaces of the mAnimationSprites vector
 	for (int i = 0; i < WALKING_SPRITES; i++) {
-		mWalkingAnimationSprites.push_back(new engine::Sprite());
+		mWalkingAnimationSprites.push_back(create<engine::Sprite>());
 	}//FOR - at the end it will have created the vector of animation sprite with desired number of spaces
 
 	/*
@@ -358,7 +368,7 @@ void Player::generateJumpingAnimation() {
 	const int JUMPING_SPRITES = 8;
 	//create a vector with designed number of sprites
 	for (int i = 0; i < JUMPING_SPRITES; i++) {
-		mJumpingAnimationSprites.push_back(new engine::Sprite());
+		mJumpingAnimationSprites.push_back(create<engine::Sprite>());
 	}//FOR - the vector will have been created
 
 	/*
@@ -416,7 +426,7 @@ void Player::generateSlidingAnimation() {
 	const int SLIDING_SPRITES = 21;
 	//create a vector with designed number of sprites
 	for (int i = 0; i < SLIDING_SPRITES; i++) {
-		mSlidingAnimationSprites.push_back(new engine::Sprite());
+		mSlidingAnimationSprites.push_back(create<engine::Sprite>());
 	} // FOR - vector will have been created
 
 	/*
@@ -539,7 +549,7 @@ void Player::generateDyingAnimation() {
 	const int DYING_SPRITES = 36;
 	//create a vector with designed number of sprites
 	for (int i = 0; i < DYING_SPRITES; i++) {
-		mDyingAnimationSprites.push_back(new engine::Sprite());
+		mDyingAnimationSprites.push_back(create<engine::Sprite>());
 	}//FOR - vector will have been created
 
 	/*
@@ -730,107 +740,67 @@ void Player::generateDyingAnimation() {
 }
 
 /**
- * @brief This method free all the pointers of player. It passes through its pointers
-* attributes, free them and point to null
+ * @brief This method writes the player state after the game object one,
+ * so a level restart can bring back the speed, the flags and the parts.
+ * @return 'void'.
+*/
+void Player::saveState(engine::StateBuffer &stateBuffer) {
+	engine::GameObject::saveState(stateBuffer);
+	stateBuffer.write(mState);
+	stateBuffer.write(mSpeed);
+	stateBuffer.write(mPushesRightWall);
+	stateBuffer.write(mPushesLeftWall);
+	stateBuffer.write(mAtCeiling);
+	stateBuffer.write(mOnGround);
+	stateBuffer.write(mCollectedParts);
+}
+
+/**
+ * @brief This method reads back the state written by saveState, in the same order.
+ * @return 'void'.
+*/
+void Player::loadState(engine::StateBuffer &stateBuffer) {
+	engine::GameObject::loadState(stateBuffer);
+	stateBuffer.read(mState);
+	stateBuffer.read(mSpeed);
+	stateBuffer.read(mPushesRightWall);
+	stateBuffer.read(mPushesLeftWall);
+	stateBuffer.read(mAtCeiling);
+	stateBuffer.read(mOnGround);
+	stateBuffer.read(mCollectedParts);
+}
+
+/**
+ * @brief This method shuts the components of player down. They're built on
+* the arena of its scene with the sprites, so they're freed with it.
 * @return 'void'.
 */
 void Player::shutdown() {
 
+	//checks if mCollider is null
+	if (mCollider != nullptr) {
+		DEBUG("Shutting down mCollider");
+		mCollider->shutdown();
+		mCollider = nullptr;
+	} else {
+		//mCollider is already null
+	}
+
 	//checks if mAnimationController is null
 	if (mAnimationController != nullptr) {
 		DEBUG("Shutting down mAnimationController");
 		mAnimationController->shutdown();
-		delete(mAnimationController);
 		mAnimationController = nullptr;
 	} else {
-		//mAnimationController is not null
-	}
-
-	//The subsequent loops will Free the corresponding sprites
-	//they run all the existing sprites on their variables
-	for (auto eachSprite : mWalkingAnimationSprites) {
-		//ASSERT(eachSprite == nullptr, "Walking sprite error");
-		if (eachSprite != nullptr) {
-			eachSprite = nullptr;
-		} else {
-			//null pointer
-		}
+		//mAnimationController is already null
 	}
 
-	for (auto eachSprite : mJumpingAnimationSprites) {
-		//ASSERT(eachSprite == nullptr, "Jumping sprite error");
-		if (eachSprite != nullptr) {
-			eachSprite = nullptr;
-		} else {
-			//null pointer
-		}
-	}
-
-	for (auto eachSprite : mSlidingAnimationSprites) {
-		//ASSERT(eachSprite == nullptr, "Sliding sprite error");
-		if (eachSprite != nullptr) {
-			eachSprite = nullptr;
-		} else {
-			//null pointer
-		}
-	}
-
-	for (auto eachSprite : mDyingAnimationSprites) {
-		//ASSERT(eachSprite == nullptr, "Dying sprite error");
-		if (eachSprite != nullptr) {
-			eachSprite = nullptr;
-		} else {
-			//null pointer
-		}
-
-		//The subsequent 'ifs' checks if the variable pointer is pointing to null
-		//ASSERT(mWalking == nullptr, "Walking component pointer error");
-		if (mWalking != nullptr) {
-			delete(mWalking);
-			mWalking = nullptr;
-		} else {
-			//null pointer
-		}
-
-		//ASSERT(mJumping == nullptr, "Jumping component pointer error");
-		if (mJumping != nullptr) {
-			delete(mJumping);
-			mJumping = nullptr;
-		} else {
-			//null pointer
-		}
-
-		//ASSERT(mSliding == nullptr, "Sliding component pointer error");
-		if (mSliding != nullptr) {
-			delete(mSliding);
-			mSliding = nullptr;
-		} else {
-			//null pointer
-		}
-
-		//ASSERT(mDying == nullptr, "Dying component pointer error");
-		if (mDying != nullptr) {
-			delete(mDying);
-			mDying = nullptr;
-		} else {
-			//null pointer
-		}
-
-		//ASSERT(mLosing == nullptr, "Losing component pointer error");
-		if (mLosing != nullptr) {
-			delete(mLosing);
-			mLosing = nullptr;
-		} else {
-			//null pointer
-		}
-
-		//ASSERT(mPlayerCode == nullptr, "PlayerCode component pointer error");
-		if (mPlayerCode != nullptr) {
-			mPlayerCode->shutdown();
-			delete(mPlayerCode);
-			mPlayerCode = nullptr;
-		} else {
-			//null pointer
-		}
+	//checks if mPlayerCode is null
+	if (mPlayerCode != nullptr) {
+		DEBUG("Shutting down mPlayerCode");
+		mPlayerCode->shutdown();
+		mPlayerCode = nullptr;
+	} else {
+		//mPlayerCode is already null
 	}
 }
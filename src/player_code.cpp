@@ -38,26 +38,10 @@ PlayerCode::PlayerCode(Player *player) {
 	mPlayer = player;
 	mPlayer->mState = PlayerState::WALK;
 	mPlayer->mOnGround = true;
-	findAnimationController();
-	findAudioController();
-}
-
-/**
- * @brief gets the animation.
- * find and sets the corresponding mPlayer animation
- * @return 'void'.
-*/
-void PlayerCode::findAnimationController() {
-	 mAnimationController = (mPlayer->getAnimationController(typeid(engine::AnimationController)));
-}
-
-/**
- * @brief gets the audio.
- * find and sets the corresponding mPlayer audio
- * @return 'void'.
-*/
-void PlayerCode::findAudioController() {
-	 mAudioController = (mPlayer->getAudioController(typeid(engine::AudioController)));
+	mAnimationController = mPlayer->getComponent<engine::AnimationController>();
+	mAudioController = mPlayer->getComponent<engine::AudioController>();
+	ASSERT(mAnimationController != NULL, "The player must have an AnimationController.");
+	ASSERT(mAudioController != NULL, "The player must have an AudioController.");
 }
 
 /**
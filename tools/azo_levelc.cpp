@@ -0,0 +1,287 @@
+/**
+ * @file azo_levelc.cpp
+ * @brief Purpose: Compiler of the text levels into the binary level format.
+ *
+ * GPL v3.0 Licence
+ * Copyright (c) 2017 Azo
+ *
+ * Notice: TheAzo, TheAzoTeam
+ * https://github.com/TecProg2018-2/Azo
+ *
+ * Reads a level written as comma separated records (see
+ * assets/levels/level_one.csv) and writes the file described in
+ * level_format.hpp, which the game maps as it is:
+ *
+ *   azo_levelc <source.csv> <output.azolevel>
+*/
+#include "level_format.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace Azo;
+
+/**
+ * @brief A LevelSource struct.
+ *
+ * Records read so far, in the order they'll be written.
+*/
+struct LevelSource {
+	LevelHeader header;
+	std::vector<LevelBackground> backgroundList;
+	std::vector<LevelAudio> audioList;
+	std::vector<LevelObstacle> obstacleList;
+	std::vector<LevelBlock> blockList;
+	std::string stringTable;
+	std::map<std::string, uint32_t> stringOffsets; // Strings already on the table.
+	bool hasPlayer;
+};
+
+static const char *sourcePath = "";
+static unsigned int lineNumber = 0;
+
+static void fail(const std::string &message) {
+	fprintf(stderr, "%s:%u: %s\n", sourcePath, lineNumber, message.c_str());
+	exit(EXIT_FAILURE);
+}
+
+static std::string trim(const std::string &text) {
+	const char *SPACES = " \t\r";
+	std::string::size_type first = text.find_first_not_of(SPACES);
+
+	if (first == std::string::npos) {
+		return "";
+	} else {
+		std::string::size_type last = text.find_last_not_of(SPACES);
+		return text.substr(first, last - first + 1);
+	}
+}
+
+static std::vector<std::string> splitFields(const std::string &line) {
+	std::vector<std::string> fieldList;
+	std::string::size_type start = 0;
+
+	while (true) {
+		std::string::size_type comma = line.find(',', start);
+
+		if (comma == std::string::npos) {
+			fieldList.push_back(trim(line.substr(start)));
+			return fieldList;
+		} else {
+			fieldList.push_back(trim(line.substr(start, comma - start)));
+			start = comma + 1;
+		}
+	}
+}
+
+static float readNumber(const std::string &field) {
+	char *end = NULL;
+	double number = strtod(field.c_str(), &end);
+
+	if (field.empty() || *end != '\0') {
+		fail("\"" + field + "\" isn't a number.");
+	} else {
+		//Nothing to do. The whole field was read.
+	}
+
+	return static_cast<float>(number);
+}
+
+static uint32_t readChoice(const std::string &field, const char *yes, const char *no) {
+	if (field == yes) {
+		return 1;
+	} else if (field == no) {
+		return 0;
+	} else {
+		fail("Expected \"" + std::string(yes) + "\" or \"" + no + "\", found \"" + field + "\".");
+		return 0;
+	}
+}
+
+// Equal strings are only stored once.
+static uint32_t addString(LevelSource &source, const std::string &text) {
+	if (text.empty()) {
+		fail("Names and paths can't be empty.");
+	} else {
+		//Nothing to do.
+	}
+
+	auto position = source.stringOffsets.find(text);
+
+	if (position != source.stringOffsets.end()) {
+		return position->second;
+	} else {
+		uint32_t offset = source.stringTable.size();
+		source.stringTable.append(text);
+		source.stringTable.push_back('\0');
+		source.stringOffsets[text] = offset;
+		return offset;
+	}
+}
+
+static uint32_t readObstacleType(const std::string &field) {
+	for (uint32_t type = 0; type < LEVEL_OBSTACLE_TYPE_COUNT; type++) {
+		if (field == LEVEL_OBSTACLE_TYPES[type]) {
+			return type;
+		} else {
+			//Nothing to do. Try the next type.
+		}
+	}
+
+	fail("Unknown obstacle type \"" + field + "\".");
+	return 0;
+}
+
+static void expectFields(const std::vector<std::string> &fieldList, unsigned int count) {
+	if (fieldList.size() != count) {
+		char message[64];
+		snprintf(message, sizeof(message), "\"%s\" takes %u fields.", fieldList[0].c_str(), count - 1);
+		fail(message);
+	} else {
+		//Nothing to do.
+	}
+}
+
+static void readRecord(LevelSource &source, const std::vector<std::string> &fieldList) {
+	const std::string &kind = fieldList[0];
+
+	if (kind == "player") {
+		expectFields(fieldList, 3);
+		source.header.playerX = readNumber(fieldList[1]);
+		source.header.playerY = readNumber(fieldList[2]);
+		source.hasPlayer = true;
+	} else if (kind == "background") {
+		expectFields(fieldList, 4);
+		LevelBackground background = {addString(source, fieldList[1]), readNumber(fieldList[2]), readNumber(fieldList[3])};
+		source.backgroundList.push_back(background);
+	} else if (kind == "audio") {
+		expectFields(fieldList, 5);
+		LevelAudio audio = {addString(source, fieldList[1]), addString(source, fieldList[2]),
+		                    readChoice(fieldList[3], "music", "sound"), readChoice(fieldList[4], "play", "wait")};
+		source.audioList.push_back(audio);
+	} else if (kind == "obstacle") {
+		expectFields(fieldList, 5);
+		LevelObstacle obstacle = {addString(source, fieldList[1]), readObstacleType(fieldList[2]),
+		                          readNumber(fieldList[3]), readNumber(fieldList[4]),
+		                          static_cast<uint32_t>(source.blockList.size()), 0};
+		source.obstacleList.push_back(obstacle);
+	} else if (kind == "block") {
+		expectFields(fieldList, 5);
+
+		if (source.obstacleList.empty()) {
+			fail("A block must follow its obstacle.");
+		} else {
+			//Nothing to do.
+		}
+
+		LevelBlock block = {readNumber(fieldList[1]), readNumber(fieldList[2]),
+		                    readNumber(fieldList[3]), readNumber(fieldList[4])};
+
+		if (block.width < 0.0f || block.height < 0.0f) {
+			fail("Blocks can't have a negative size.");
+		} else {
+			//Nothing to do.
+		}
+
+		source.blockList.push_back(block);
+		source.obstacleList.back().blockCount++;
+	} else {
+		fail("Unknown record \"" + kind + "\".");
+	}
+}
+
+template <typename T>
+static void writeRecords(FILE *file, const std::vector<T> &recordList) {
+	if (!recordList.empty() && fwrite(&recordList[0], sizeof(T), recordList.size(), file) != recordList.size()) {
+		fail("Can't write the level.");
+	} else {
+		//Nothing to do.
+	}
+}
+
+int main(int argc, char **argv) {
+	if (argc != 3) {
+		fprintf(stderr, "Usage: %s <source.csv> <output.azolevel>\n", argv[0]);
+		return EXIT_FAILURE;
+	} else {
+		//Nothing to do.
+	}
+
+	sourcePath = argv[1];
+	std::ifstream sourceFile(sourcePath);
+
+	if (!sourceFile.is_open()) {
+		fail("Can't open the source.");
+	} else {
+		//Nothing to do.
+	}
+
+	LevelSource source;
+	memset(&source.header, 0, sizeof(source.header));
+	memcpy(source.header.magic, LEVEL_MAGIC, sizeof(LEVEL_MAGIC));
+	source.header.version = LEVEL_VERSION;
+	source.hasPlayer = false;
+	std::string line;
+
+	while (std::getline(sourceFile, line)) {
+		lineNumber++;
+		std::string record = trim(line);
+
+		if (record.empty() || record[0] == '#') {
+			//Nothing to do. Blank lines and comments are skipped.
+		} else {
+			readRecord(source, splitFields(record));
+		}
+	}
+
+	lineNumber = 0;
+
+	if (!source.hasPlayer) {
+		fail("The level has no player record.");
+	} else {
+		//Nothing to do.
+	}
+
+	source.header.backgroundCount = source.backgroundList.size();
+	source.header.audioCount = source.audioList.size();
+	source.header.obstacleCount = source.obstacleList.size();
+	source.header.blockCount = source.blockList.size();
+	// The game refuses an empty table, so there's always a terminator at the end.
+	source.stringTable.push_back('\0');
+	source.header.stringTableSize = source.stringTable.size();
+
+	FILE *outputFile = fopen(argv[2], "wb");
+
+	if (outputFile == NULL) {
+		fprintf(stderr, "Can't create %s\n", argv[2]);
+		return EXIT_FAILURE;
+	} else {
+		//Nothing to do.
+	}
+
+	sourcePath = argv[2];
+	fwrite(&source.header, sizeof(source.header), 1, outputFile);
+	writeRecords(outputFile, source.backgroundList);
+	writeRecords(outputFile, source.audioList);
+	writeRecords(outputFile, source.obstacleList);
+	writeRecords(outputFile, source.blockList);
+	fwrite(source.stringTable.data(), 1, source.stringTable.size(), outputFile);
+
+	if (fclose(outputFile) != 0) {
+		fail("Can't write the level.");
+	} else {
+		//Nothing to do.
+	}
+
+	printf("%s: %u obstacles, %u blocks, %lu bytes.\n", argv[2], source.header.obstacleCount,
+	       source.header.blockCount, static_cast<unsigned long>(sizeof(LevelHeader) +
+	       source.backgroundList.size() * sizeof(LevelBackground) + source.audioList.size() * sizeof(LevelAudio) +
+	       source.obstacleList.size() * sizeof(LevelObstacle) + source.blockList.size() * sizeof(LevelBlock) +
+	       source.stringTable.size()));
+	return EXIT_SUCCESS;
+}